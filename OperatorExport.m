@@ -331,6 +331,74 @@ ConvertFullExpression[sumOfExprs_,ComplexPars_]:=Module[{exprList,str},
 ];
 
 
+(* ::Subsection:: *)
+(*Write out the flavour sums of EinsSum calls explicitly*)
+
+
+(* number of flavours of the model, fixes the sizes of the flavour-indexed parameters and the ranges of all flavour indices *)
+NumFlavours = 3;
+
+(* how the EinsSum calls are written to the source file:
+   "EinsSum"  - runtime calls to EinsSum, which interpret the index pattern
+   "Loops"    - nested loops over the repeated indices, in an immediately invoked lambda
+   "Unrolled" - explicit sums over all values of the repeated indices, with a fallback to "Loops" above MaxUnrolledTerms terms
+   "Templates" - calls to the compile-time Contraction<...>::eval of OperatorImport.h, with the index pattern as template arguments *)
+FlavourSumMode = "EinsSum";
+MaxUnrolledTerms = 27;
+
+(* number of lib/<model>_partN.cpp files next to lib/<model>.cpp, over which the WC functions and the shared subexpressions are split
+   so that they compile in parallel; the split balances the size of the code generated into every part *)
+NumSourceParts = 8;
+
+(* number of terms of a WC function added up in one immediately invoked lambda; gcc takes a time that grows faster than the length
+   of a function to allocate its registers, and the largest WCs have some 3000 terms *)
+MaxFunctionTerms = 200;
+
+(* names of the vector-valued parameters, set by SourceFileBuilder *)
+VectorParams = {};
+
+(* C++ expression for one component of a tensor, given the names of the indices in its slots *)
+TensorComponent[LoopFunc[masses_List,code_,mu_],idx_] := Module[{k=0},
+	"LFCache::eval({"<>StringRiffle[If[MemberQ[VectorParams,ToString[#]], k++; ToString[#]<>"["<>idx[[k]]<>"]", ToString[#]]&/@masses,", "]<>"}, "<>ToString[code]<>", "<>ToString[mu]<>")"
+];
+TensorComponent[MassPow[m_,n_],idx_] := "pow("<>ToString[m]<>If[Length[idx]!=0,"["<>idx[[1]]<>"]",""]<>", "<>ToString[n]<>")";
+TensorComponent[mat_Symbol,idx_] := ToString[mat]<>StringJoin[("["<>#<>"]")&/@idx];
+
+(* argument of Contraction<...>::eval for a tensor with n slots: matrices are passed as they are, the others as lambdas of their indices *)
+TensorArgument[mat_Symbol,n_] := ToString[mat];
+TensorArgument[t_,n_] := Module[{idx},
+	idx = Table["k"<>ToString[j],{j,1,n}];
+	"[&]("<>StringRiffle[("int "<>#)&/@idx,", "]<>") { return "<>TensorComponent[t,idx]<>"; }"
+];
+
+(* same summation order as EinsSum: the first repeated index runs slowest and the factors are multiplied from left to right,
+   so that all three modes give identical results *)
+FlavourSumExpr[tensors_List,order_List,free_List] := Module[{numIdx,f=0,names,prod,vals},
+	numIdx = Max[Append[Cases[order,_Integer?(#<=10&),{2}],0]];
+	names = Map[If[#>10, f++; ToString[free[[f]]], "r"<>ToString[#]]&, order, {2}];
+	prod[nm_] := StringRiffle[MapThread[TensorComponent,{tensors,nm}],"*"];
+	Which[
+		FlavourSumMode==="Templates",
+		"FlavourContraction<num_flavours, "<>StringRiffle[("Slots<"<>StringRiffle[ToString/@#,","]<>">")&/@order,", "]<>" >::eval({"<>StringRiffle[ToString/@free,","]<>"}, "<>
+			StringRiffle[MapThread[TensorArgument,{tensors,Length/@order}],", "]<>")",
+		numIdx==0,
+		"("<>prod[names]<>")",
+		FlavourSumMode==="Unrolled" && NumFlavours^numIdx<=MaxUnrolledTerms,
+		vals = Tuples[Range[0,NumFlavours-1],numIdx];
+		"("<>StringRiffle[Table[prod[names/.Table["r"<>ToString[j]->ToString[v[[j]]],{j,1,numIdx}]],{v,vals}]," + "]<>")",
+		True,
+		"[&]() { double s = 0.0; "<>StringJoin[Table["for (int r"<>ToString[j]<>" = 0; r"<>ToString[j]<>" < num_flavours; r"<>ToString[j]<>"++) ",{j,1,numIdx}]]<>
+			"s += "<>prod[names]<>"; return s; }()"
+	]
+];
+
+(* rewrites every EinsSum call in a C++ expression according to FlavourSumMode *)
+ExpandFlavourSums[str_] := If[FlavourSumMode==="EinsSum", StringReplace[str, "EinsSum(" -> "EinsSum<num_flavours>("],
+	StringReplace[str, call:("EinsSum(" ~~ Shortest[__] ~~ "})") :>
+		(ToExpression[StringReplace[call,{"("->"[",")"->"]"}]] /. EinsSum[t_,o_,f_] :> FlavourSumExpr[t,o,f])]
+];
+
+
 (* ::Section:: *)
 (*Build C++ functions and write them to file*)
 
@@ -349,12 +417,17 @@ HeaderPreprocessorDirectives[line_] := Module[{},
 	WriteLine[line, "#include <string>"];
 	WriteLine[line, "#include <map>"];
 	WriteLine[line, "#include <functional>"];
+	WriteLine[line, "#include <array>"];
+	WriteLine[line, "#include \"OperatorImport.h\""];
 	WriteLine[line, "#define hbar 0.006332574"]
 ];
 
 HeaderModelClass[className_,paramList_,line_] := Module[{args},
 	WriteLine[line, ""];
 	WriteLine[line, "class "<>className<>" {"];
+	WriteLine[line, "    public:"];
+	WriteLine[line, "        static constexpr int num_flavours = "<>ToString[NumFlavours]<>";    // size of the flavour-indexed parameters"];
+	WriteLine[line, ""];
 	WriteLine[line, "    private:"];
 	
 	(* define and initialize 0-dimensional parameters *)
@@ -365,16 +438,38 @@ HeaderModelClass[className_,paramList_,line_] := Module[{args},
 	
 	(* define and initialize 1-dimensional parameters (masses) *)
 	If[Length[paramList[[2]]]!=0,
-		Do[WriteLine[line, "        "<>"std::vector<double> "<>ToString[paramList[[2]][[i]]]<>" = {0.0, 0.0, 0.0};"], {i,1,Length[paramList[[2]]]}];
+		Do[WriteLine[line, "        "<>"std::array<double, num_flavours> "<>ToString[paramList[[2]][[i]]]<>"{};"], {i,1,Length[paramList[[2]]]}];
 	];
 	WriteLine[line, ""];
 	
 	(* define and initialize 2-dimensional parameters *)
 	If[Length[paramList[[3]]]!=0,
-		Do[WriteLine[line, "        "<>"std::vector<std::vector<double> > "<>ToString[paramList[[3]][[i]]]<>" = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};"],
+		Do[WriteLine[line, "        "<>"std::array<std::array<double, num_flavours>, num_flavours> "<>ToString[paramList[[3]][[i]]]<>"{};"],
 		{i,1,Length[paramList[[3]]]}];
 	];
 	WriteLine[line, ""];
+	
+	WriteLine[line, "        std::vector<double> sh_buf;    // workspace for the subexpressions shared between WCs"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // the subexpressions in sh_buf and the WCs in wc_buf are only recomputed when a parameter they depend on changes"];
+	WriteLine[line, "        std::vector<double> sh_params;    // parameters at the last evaluation, in the order of the parameter enum"];
+	WriteLine[line, "        double sh_mubarsq = 0.0;"];
+	WriteLine[line, "        std::vector<char> sh_valid;"];
+	WriteLine[line, "        std::vector<char> wc_valid;"];
+	WriteLine[line, "        "<>className<>"Coefficients wc_buf;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        std::vector<double> sh_batch;    // values of the _batch methods for batch_block points, one row of lanes per value"];
+	WriteLine[line, ""];
+	WriteLine[line, "        std::vector<Dual> sh_dual;    // workspace of derivatives"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // pruned evaluation, see setPruning"];
+	WriteLine[line, "        double prune_tolerance = 0.0;"];
+	WriteLine[line, "        std::vector<double> prune_min;    // smallest and largest |component| of every parameter at the last evaluation, by dependency bit"];
+	WriteLine[line, "        std::vector<double> prune_max;"];
+	WriteLine[line, "        std::vector<char> sh_pruned;    // pruning decision of every shared item, made by decidePruning"];
+	WriteLine[line, "        std::size_t num_pruned = 0;"];
+	WriteLine[line, "        bool prune_frozen = false;    // keeps the decisions when only the scale changes, for evaluateScales"];
+	WriteLine[line, ""];
 		
 	WriteLine[line, "    public:"];
 	(* declaration for the default constructor*)
@@ -382,11 +477,33 @@ HeaderModelClass[className_,paramList_,line_] := Module[{args},
 	WriteLine[line, ""];
 	
 	(* declaration for the overloaded constructor*)
-	WriteLine[line, StringJoin["        ", className, "(std::map<std::string, double> params);"]];
+	WriteLine[line, StringJoin["        ", className, "(const std::map<std::string, double>& params);"]];
 	WriteLine[line, ""];
 
 	(* declaration for the updater method *)
-	WriteLine[line, StringJoin["        void updateParams", "(std::map<std::string, double> params);"]];
+	WriteLine[line, "        // names in params that are not parameters of the model are ignored"];
+	WriteLine[line, StringJoin["        void updateParams", "(const std::map<std::string, double>& params);"]];
+	WriteLine[line, ""];
+	
+	(* declarations for the typed and bulk access to the parameters *)
+	WriteLine[line, "        // typed access to single parameters, without string lookups"];
+	WriteLine[line, "        // the loop-function cache is keyed on the values of the masses and stays valid, it is only cleared by updateParams and setParams and has a fixed size"];
+	WriteLine[line, "        using Param = "<>className<>"Param;"];
+	WriteLine[line, "        static constexpr int num_params = static_cast<int>("<>className<>"Param::count);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        void setParam("<>className<>"Param p, double value);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        double getParam("<>className<>"Param p) const;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // bulk access to all parameters, values[k] belongs to "<>className<>"Param(k)"];
+	WriteLine[line, "        void setParams(const double* values);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        void getParams(double* values) const;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // conversion between parameter names and "<>className<>"Param, paramIndex throws std::invalid_argument for unknown names"];
+	WriteLine[line, "        static "<>className<>"Param paramIndex(const std::string& name);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        static const std::string& paramName("<>className<>"Param p);"];
 	WriteLine[line, ""];
 	
 	(* declaration for a method that prints the names of all parameters *)
@@ -402,6 +519,58 @@ HeaderModelClass[className_,paramList_,line_] := Module[{args},
 	
 	WriteLine[line, ""];
 	
+	(* declarations for methods that evaluate all flavour components of a WC (Warsaw) at once *)
+	WriteLine[line, "        // components are stored row-major, e.g. out[3*i1 + i2] or out[27*i1 + 9*i2 + 3*i3 + i4]"];
+	Do[
+		If[NumFlavourIdx[Values[WarsawAll][[i]]]!=0,
+			WriteLine[line,"        void "<>WCName[Values[WarsawAll][[i]]]<>"_all(double mubarsq, double* out);"]],
+	{i,1,Length[WarsawAll]}];
+	
+	WriteLine[line, ""];
+	
+	(* declarations for the batched WC methods over a structure-of-arrays block of points *)
+	WriteLine[line, "        // batched evaluation over a block of points, out[c*points.size + n] is the component c (row-major as in the _all methods)"];
+	WriteLine[line, "        // at point n: the shared items of every point are computed as in the _all methods, then the WC is combined for batch_block"];
+	WriteLine[line, "        // points at a time in loops over the points, which the compiler vectorizes at -O3 (GCC 12 and later already at -O2); the"];
+	WriteLine[line, "        // parameters of the model are restored at the end"];
+	WriteLine[line, "        static constexpr std::size_t batch_block = 16;"];
+	WriteLine[line, ""];
+	Do[WriteLine[line,"        void "<>WCName[Values[WarsawAll][[i]]]<>"_batch(const "<>className<>"Batch& points, double mubarsq, double* out);"],{i,1,Length[WarsawAll]}];
+	
+	WriteLine[line, ""];
+	
+	(* declarations for the evaluation of all (or of a subset of) WCs with shared subexpressions *)
+	WriteLine[line, "        // evaluation of all (or of a requested subset of) WCs, subexpressions shared between them are computed once"];
+	WriteLine[line, "        "<>className<>"Coefficients evaluateAll(double mubarsq);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        "<>className<>"Coefficients evaluate(double mubarsq, const std::vector<std::string>& wc_names);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // names of all WCs accepted by evaluate, in the order in which evaluateAll computes them"];
+	WriteLine[line, "        static const std::vector<std::string>& wcNames();"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // split of all WCs into their scale-independent part and the coefficient of log(mubarsq), from evaluateAll at two scales,"];
+	WriteLine[line, "        // see "<>className<>"ScaleCoefficients for its precision"];
+	WriteLine[line, "        "<>className<>"ScaleCoefficients evaluateScales(double mubarsq);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // values and first derivatives of the WCs in wc_names with respect to the parameters in directions, by forward-mode"];
+	WriteLine[line, "        // automatic differentiation: the shared items and the WCs are evaluated once on Dual numbers, which carry dual_directions"];
+	WriteLine[line, "        // derivatives, so that every further dual_directions parameters take another pass; the values are the ones of evaluate"];
+	WriteLine[line, "        // without pruning, and the state of the incremental evaluation is left as it is"];
+	WriteLine[line, "        "<>className<>"Derivatives derivatives(double mubarsq, const std::vector<std::string>& wc_names, const std::vector<"<>className<>"Param>& directions);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // pruned evaluation for decoupled heavy states: evaluateAll, evaluate and the _all methods set shared term groups (an"];
+	WriteLine[line, "        // EinsSum with a loop function) to zero as long as the upper bounds on their contributions add up to less than tolerance in"];
+	WriteLine[line, "        // every WC, so that all pruned groups together change every WC component by less than tolerance; the groups are decided"];
+	WriteLine[line, "        // once per parameter point and scale, and evaluateScales keeps the decisions of mubarsq at 4*mubarsq; tolerance 0 switches"];
+	WriteLine[line, "        // the pruning off"];
+	WriteLine[line, "        void setPruning(double tolerance);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        double pruningTolerance() const;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // number of term groups set to zero in the current results"];
+	WriteLine[line, "        std::size_t prunedTerms() const;"];
+	WriteLine[line, ""];
+	
 	(* declaration and definition of std::function lambdas that bind to the Yukawa member functions of the model class *)
 	(*If[Length[paramList[[4]]]!=0,
 		Do[WriteLine[line, "        "<>"std::function<double(int, int, double)> "<>ToString[paramList[[4]][[i]]]<>"_ = [this](int i, int j, double m){ return this->"<>ToString[paramList[[4]][[i]]]<>"(i, j, m); };"],
@@ -409,6 +578,161 @@ HeaderModelClass[className_,paramList_,line_] := Module[{args},
 	];*)
 	WriteLine[line, ""];
 	
+	(* table of shared subexpressions and the fill methods, the sizes of the table are defined by SourceFileBuilder *)
+	WriteLine[line, "    private:"];
+	WriteLine[line, "        static const int num_shared_items;"];
+	WriteLine[line, "        static const int num_shared_values;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        void computeShared(int k, double mubarsq, double* sh);"];
+	Do[WriteLine[line, "        void computeShared_part"<>ToString[i]<>"(int k, double mubarsq, double* sh);"],{i,1,NumSourceParts}];
+	WriteLine[line, ""];
+	WriteLine[line, "        // marks the subexpressions and WCs that depend on the parameters or the scale changed since the last evaluation"];
+	WriteLine[line, "        void invalidate(double mubarsq);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // bounds on the terms that multiply the shared items of a part, for the pruned evaluation: the terms of the WC wc are at most"];
+	WriteLine[line, "        // coefficient*factors[factor]*prod_b x_b^monomials[monomial][b] times the item without its flavour sum, with the largest"];
+	WriteLine[line, "        // |component| x_b of the parameters of dependency bit b for positive exponents and the smallest one for negative exponents"];
+	WriteLine[line, "        static constexpr int num_dep_bits = "<>ToString[Length[paramList[[1]]]+Length[paramList[[2]]]+Length[paramList[[3]]]]<>";"];
+	WriteLine[line, ""];
+	WriteLine[line, "        struct TermBound {"];
+	WriteLine[line, "            int wc;"];
+	WriteLine[line, "            int monomial;"];
+	WriteLine[line, "            int factor;"];
+	WriteLine[line, "            double coefficient;"];
+	WriteLine[line, "        };"];
+	WriteLine[line, ""];
+	WriteLine[line, "        struct PruneTable {"];
+	WriteLine[line, "            int first_item;"];
+	WriteLine[line, "            int end_item;"];
+	WriteLine[line, "            std::vector<int> item_bounds;    // the bounds of item first_item + i are [item_bounds[i], item_bounds[i + 1]) in bounds"];
+	WriteLine[line, "            std::vector<TermBound> bounds;"];
+	WriteLine[line, "            std::vector<std::array<signed char, num_dep_bits> > monomials;"];
+	WriteLine[line, "        };"];
+	WriteLine[line, ""];
+	Do[WriteLine[line, "        static const PruneTable& pruneTable_part"<>ToString[i]<>"();"],{i,1,NumSourceParts}];
+	WriteLine[line, ""];
+	WriteLine[line, "        // |sums of parameters| in the bounds of a part, by TermBound::factor"];
+	Do[WriteLine[line, "        void pruneFactors_part"<>ToString[i]<>"(std::vector<double>& factors) const;"],{i,1,NumSourceParts}];
+	WriteLine[line, ""];
+	WriteLine[line, "        // decides which items are pruned at the parameter values and the scale mubarsq, and marks the items and WCs whose decision changed"];
+	WriteLine[line, "        void decidePruning(const double* values, double mubarsq);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        void prunePart(const PruneTable& table, const std::vector<double>& factors, double mubarsq, std::vector<double>& used);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // sets the values of the shared item k in sh to zero if it is pruned"];
+	WriteLine[line, "        bool pruneShared(int k, double* sh);"];
+	WriteLine[line, ""];
+	WriteLine[line, "        static const std::map<std::string, std::vector<int> >& sharedItems();"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // loads point n of a batch, computes the shared items and copies their values, in the order of items, into the lane of sh_batch"];
+	WriteLine[line, "        void loadBatchPoint(const "<>className<>"Batch& points, std::size_t n, double mubarsq, const std::vector<int>& items, std::size_t lane);"];
+	WriteLine[line, ""];
+	Do[WriteLine[line,"        void "<>WCName[Values[WarsawAll][[i]]]<>"_fill(double mubarsq, const double* sh, double* out);"],{i,1,Length[WarsawAll]}];
+	WriteLine[line, ""];
+	
+	(* the parameters and the counterparts of computeShared and of the fill methods on Dual numbers, for derivatives *)
+	WriteLine[line, "        struct DualParams {"];
+	Do[WriteLine[line, "            Dual "<>ToString[paramList[[1]][[i]]]<>";"],{i,1,Length[paramList[[1]]]}];
+	Do[WriteLine[line, "            std::array<Dual, num_flavours> "<>ToString[paramList[[2]][[i]]]<>";"],{i,1,Length[paramList[[2]]]}];
+	Do[WriteLine[line, "            std::array<std::array<Dual, num_flavours>, num_flavours> "<>ToString[paramList[[3]][[i]]]<>";"],{i,1,Length[paramList[[3]]]}];
+	WriteLine[line, "        };"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // the parameters with the derivative j in the direction of the parameter directions[first + j]"];
+	WriteLine[line, "        void dualParams(const std::vector<"<>className<>"Param>& directions, std::size_t first, DualParams& p) const;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        void computeSharedDual(int k, double mubarsq, const DualParams& p, Dual* sh) const;"];
+	Do[WriteLine[line, "        void computeSharedDual_part"<>ToString[i]<>"(int k, double mubarsq, const DualParams& p, Dual* sh) const;"],{i,1,NumSourceParts}];
+	WriteLine[line, ""];
+	Do[WriteLine[line,"        void "<>WCName[Values[WarsawAll][[i]]]<>"_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;"],{i,1,Length[WarsawAll]}];
+	WriteLine[line, ""];
+	
+	WriteLine[line, "};"];
+];
+
+HeaderCoefficientStruct[className_,line_] := Module[{n},
+	WriteLine[line, ""];
+	WriteLine[line, "// values of all WCs at one parameter point, flavour components are stored row-major as in the _all methods"];
+	WriteLine[line, "struct "<>className<>"Coefficients {"];
+	Do[
+		n = NumFlavourIdx[Values[WarsawAll][[i]]];
+		WriteLine[line, "    "<>If[n==0,"double "<>WCName[Values[WarsawAll][[i]]]<>" = 0.0;","std::array<double, "<>ToString[NumFlavours^n]<>"> "<>WCName[Values[WarsawAll][[i]]]<>"{};"]],
+	{i,1,Length[WarsawAll]}];
+	WriteLine[line, "};"];
+	
+	WriteLine[line, ""];
+	WriteLine[line, "// all WCs as a + b*log(mubarsq); every loop function is affine in log(mubarsq), so the split is exact up to rounding. evaluateScales"];
+	WriteLine[line, "// takes it from evaluateAll at mubarsq and 4*mubarsq, b = (c(4*mubarsq) - c(mubarsq))/log(4) and a = c(mubarsq) - b*log(mubarsq):"];
+	WriteLine[line, "// with e the rounding error of evaluateAll (a few eps times the largest term of a WC), b has an absolute error of about 2e/log(4),"];
+	WriteLine[line, "// which is a large relative error for WCs that barely depend on the scale, and a about |log(mubarsq)| times that"];
+	WriteLine[line, "struct "<>className<>"ScaleCoefficients {"];
+	WriteLine[line, "    "<>className<>"Coefficients a;"];
+	WriteLine[line, "    "<>className<>"Coefficients b;"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // values of all WCs at the scale mubarsq, with one multiply-add per component"];
+	WriteLine[line, "    "<>className<>"Coefficients at(double mubarsq) const;"];
+	WriteLine[line, "};"];
+	
+	WriteLine[line, ""];
+	WriteLine[line, "// values of WCs together with their first derivatives, gradient[j] holds the derivatives with respect to the j-th parameter"];
+	WriteLine[line, "// passed to derivatives"];
+	WriteLine[line, "struct "<>className<>"Derivatives {"];
+	WriteLine[line, "    "<>className<>"Coefficients value;"];
+	WriteLine[line, "    std::vector<"<>className<>"Coefficients> gradient;"];
+	WriteLine[line, "};"];
+];
+
+
+(* ::Subsubsection:: *)
+(*Builder for the enumeration of the parameters*)
+
+
+(* column names of all parameters, in the same order as the map keys accepted by the constructor *)
+ParamColumns[paramList_] := {
+	ToString/@paramList[[1]],
+	Table[Table[ToString[paramList[[2]][[i]]]<>ToString[j],{j,1,NumFlavours}],{i,1,Length[paramList[[2]]]}],
+	Table[Flatten[Table[ToString[paramList[[3]][[i]]]<>ToString[j]<>ToString[k],{j,1,NumFlavours},{k,1,NumFlavours}]],{i,1,Length[paramList[[3]]]}]
+};
+
+HeaderParamEnum[className_,paramList_,line_] := Module[{cols},
+	cols = ParamColumns[paramList];
+	WriteLine[line, ""];
+	WriteLine[line, "// parameters of the model, vectors and matrices are split into their components (matrices row-major)"];
+	WriteLine[line, "enum class "<>className<>"Param : int {"];
+	If[Length[cols[[1]]]!=0, WriteLine[line, "    "<>StringRiffle[cols[[1]],", "]<>","]];
+	Do[WriteLine[line, "    "<>StringRiffle[cols[[2]][[i]],", "]<>","],{i,1,Length[cols[[2]]]}];
+	Do[WriteLine[line, "    "<>StringRiffle[cols[[3]][[i]],", "]<>","],{i,1,Length[cols[[3]]]}];
+	WriteLine[line, "    count"];
+	WriteLine[line, "};"];
+];
+
+
+(* ::Subsubsection:: *)
+(*Builder for the structure-of-arrays block used by the batched WC methods*)
+
+
+HeaderBatchStruct[className_,paramList_,line_] := Module[{cols},
+	cols = ParamColumns[paramList];
+	WriteLine[line, ""];
+	WriteLine[line, "// structure-of-arrays block of parameter points for the _batch methods, with one column of length size per parameter"];
+	WriteLine[line, "struct "<>className<>"Batch {"];
+	WriteLine[line, "    std::size_t size = 0;"];
+	WriteLine[line, ""];
+	If[Length[cols[[1]]]!=0,
+		WriteLine[line, "    std::vector<double> "<>StringRiffle[cols[[1]],", "]<>";"];
+		WriteLine[line, ""]
+	];
+	If[Length[cols[[2]]]!=0,
+		Do[WriteLine[line, "    std::vector<double> "<>StringRiffle[cols[[2]][[i]],", "]<>";"],{i,1,Length[cols[[2]]]}];
+		WriteLine[line, ""]
+	];
+	If[Length[cols[[3]]]!=0,
+		Do[WriteLine[line, "    std::vector<double> "<>StringRiffle[cols[[3]][[i]],", "]<>";"],{i,1,Length[cols[[3]]]}];
+		WriteLine[line, ""]
+	];
+	WriteLine[line, "    "<>className<>"Batch() = default;"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // every column is filled with the value from params, or 0.0 if it is absent"];
+	WriteLine[line, "    "<>className<>"Batch(std::size_t n, const std::map<std::string, double>& params = {});"];
 	WriteLine[line, "};"];
 ];
 
@@ -422,6 +746,9 @@ HeaderFileBuilder[modelName_,paramList_]:=Module[{path,line1},
 	line1 = OpenWrite[path<>"/"<>modelName<>".h"];
 	HeaderPreprocessorDirectives[line1];
 	WriteLine[line1,""];
+	HeaderParamEnum[modelName,paramList,line1];
+	HeaderBatchStruct[modelName,paramList,line1];
+	HeaderCoefficientStruct[modelName,line1];
 	HeaderModelClass[modelName,paramList,line1];
 	Close[line1];
 ];
@@ -444,75 +771,97 @@ BuildPreprocessorDirectives[modelName_,line_] := Module[{},
 	WriteLine[line, "#include <string>"];
 	WriteLine[line, "#include <map>"];
 	WriteLine[line, "#include <tuple>"];
+	WriteLine[line, "#include <stdexcept>"];
+	WriteLine[line, "#include <unordered_map>"];
+	WriteLine[line, "#include <array>"];
+	WriteLine[line, "#include <algorithm>"];
+	WriteLine[line, "#include <cstring>"];
 	WriteLine[line, "#include \"OperatorImport.h\""];
 	WriteLine[line, "#include \""<>modelName<>".h\""];
 ];
 
-BuildConstructor[className_, paramList_, line_]:=Module[{args},
+(* names of all parameter components together with the member they are stored in, in the order of the parameter enum *)
+ParamComponents[paramList_] := Join[
+	Table[{ToString[paramList[[1]][[i]]], "this->"<>ToString[paramList[[1]][[i]]]}, {i,1,Length[paramList[[1]]]}],
+	Flatten[Table[{ToString[paramList[[2]][[i]]]<>ToString[j], "this->"<>ToString[paramList[[2]][[i]]]<>"["<>ToString[j-1]<>"]"}, {i,1,Length[paramList[[2]]]},{j,1,NumFlavours}],1],
+	Flatten[Table[{ToString[paramList[[3]][[i]]]<>ToString[j]<>ToString[k], "this->"<>ToString[paramList[[3]][[i]]]<>"["<>ToString[j-1]<>"]["<>ToString[k-1]<>"]"}, {i,1,Length[paramList[[3]]]},{j,1,NumFlavours},{k,1,NumFlavours}],2]
+];
+
+BuildConstructor[className_, paramList_, line_]:=Module[{},
 	WriteLine[line, ""];
-	WriteLine[line, StringJoin[className, "::", className, "(std::map<std::string, double> params) {"]];
-	
-	If[Length[paramList[[1]]]!=0,
-		Do[WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[1]][[i]]]<>"\")) this->"<>ToString[paramList[[1]][[i]]]<>" = params[\""<>ToString[paramList[[1]][[i]]]<>"\"];"], 
-			{i,1,Length[paramList[[1]]]}]	
-	];
-	
-	If[Length[paramList[[2]]]!=0,
-		Do[
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"1\")) this->"<>ToString[paramList[[2]][[i]]]<>"[0] = params[\""<>ToString[paramList[[2]][[i]]]<>"1\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"2\")) this->"<>ToString[paramList[[2]][[i]]]<>"[1] = params[\""<>ToString[paramList[[2]][[i]]]<>"2\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"3\")) this->"<>ToString[paramList[[2]][[i]]]<>"[2] = params[\""<>ToString[paramList[[2]][[i]]]<>"3\"];"], 
-		{i,1,Length[paramList[[2]]]}]	
-	];
+	WriteLine[line, StringJoin[className, "::", className, "(const std::map<std::string, double>& params) {"]];
+	WriteLine[line, "    updateParams(params);"];
+	WriteLine[line, StringJoin["}"]];
+];
+
+BuildUpdater[className_, paramList_, line_]:=Module[{comps},
+	comps = ParamComponents[paramList];
 	
-	If[Length[paramList[[3]]]!=0,
-		Do[
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"11\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"11\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"12\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"12\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"13\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"13\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"21\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"21\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"22\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"22\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"23\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"23\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"31\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"31\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"32\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"32\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"33\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"33\"];"], 
-		{i,1,Length[paramList[[3]]]}]	
-	];
+	WriteLine[line, ""];
+	WriteLine[line, "// lookup table from parameter names to "<>className<>"Param"];
+	WriteLine[line, "static const std::unordered_map<std::string, "<>className<>"Param>& paramIndices() {"];
+	WriteLine[line, "    static const std::unordered_map<std::string, "<>className<>"Param> indices = {"];
+	Do[WriteLine[line, "        {\""<>comps[[i,1]]<>"\", "<>className<>"Param::"<>comps[[i,1]]<>"}"<>If[i<Length[comps],",",""]],{i,1,Length[comps]}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return indices;"];
+	WriteLine[line, "}"];
 	
-	WriteLine[line, StringJoin["}"]];
+	WriteLine[line, ""];
+	WriteLine[line, StringJoin["void ", className, "::updateParams", "(const std::map<std::string, double>& params) {"]];
+	WriteLine[line, "    for (const auto& [name, value] : params) {"];
+	WriteLine[line, "        auto it = paramIndices().find(name);"];
+	WriteLine[line, "        if (it != paramIndices().end()) setParam(it->second, value);"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // loop-function values cached for the previous parameter point are no longer needed"];
+	WriteLine[line, "    LFCache::clear();"];
+	WriteLine[line, "}"];
 ];
 
-BuildUpdater[className_, paramList_, line_]:=Module[{},
+BuildParamAccess[className_, paramList_, line_]:=Module[{comps},
+	comps = ParamComponents[paramList];
+	
 	WriteLine[line, ""];
-	WriteLine[line, StringJoin["void ", className, "::updateParams", "(std::map<std::string, double> params) {"]];
+	WriteLine[line, "void "<>className<>"::setParam("<>className<>"Param p, double value) {"];
+	WriteLine[line, "    switch (p) {"];
+	Do[WriteLine[line, "        case "<>className<>"Param::"<>comps[[i,1]]<>": "<>comps[[i,2]]<>" = value; break;"],{i,1,Length[comps]}];
+	WriteLine[line, "        default: throw std::invalid_argument {\"Unknown parameter.\"};"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
 	
-	If[Length[paramList[[1]]]!=0,
-		Do[WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[1]][[i]]]<>"\")) this->"<>ToString[paramList[[1]][[i]]]<>" = params[\""<>ToString[paramList[[1]][[i]]]<>"\"];"], 
-		{i,1,Length[paramList[[1]]]}]	
-	];
+	WriteLine[line, ""];
+	WriteLine[line, "double "<>className<>"::getParam("<>className<>"Param p) const {"];
+	WriteLine[line, "    switch (p) {"];
+	Do[WriteLine[line, "        case "<>className<>"Param::"<>comps[[i,1]]<>": return "<>comps[[i,2]]<>";"],{i,1,Length[comps]}];
+	WriteLine[line, "        default: throw std::invalid_argument {\"Unknown parameter.\"};"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
 	
-	If[Length[paramList[[2]]]!=0,
-		Do[
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"1\")) this->"<>ToString[paramList[[2]][[i]]]<>"[0] = params[\""<>ToString[paramList[[2]][[i]]]<>"1\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"2\")) this->"<>ToString[paramList[[2]][[i]]]<>"[1] = params[\""<>ToString[paramList[[2]][[i]]]<>"2\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[2]][[i]]]<>"3\")) this->"<>ToString[paramList[[2]][[i]]]<>"[2] = params[\""<>ToString[paramList[[2]][[i]]]<>"3\"];"], 
-		{i,1,Length[paramList[[2]]]}]	
-	];
+	WriteLine[line, ""];
+	WriteLine[line, "void "<>className<>"::setParams(const double* values) {"];
+	Do[WriteLine[line, "    "<>comps[[i,2]]<>" = values["<>ToString[i-1]<>"];"],{i,1,Length[comps]}];
+	WriteLine[line, ""];
+	WriteLine[line, "    LFCache::clear();"];
+	WriteLine[line, "}"];
 	
-	If[Length[paramList[[3]]]!=0,
-		Do[
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"11\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"11\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"12\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"12\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"13\")) this->"<>ToString[paramList[[3]][[i]]]<>"[0][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"13\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"21\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"21\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"22\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"22\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"23\")) this->"<>ToString[paramList[[3]][[i]]]<>"[1][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"23\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"31\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][0] = params[\""<>ToString[paramList[[3]][[i]]]<>"31\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"32\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][1] = params[\""<>ToString[paramList[[3]][[i]]]<>"32\"];"];
-			WriteLine[line, "    if (params.contains(\""<>ToString[paramList[[3]][[i]]]<>"33\")) this->"<>ToString[paramList[[3]][[i]]]<>"[2][2] = params[\""<>ToString[paramList[[3]][[i]]]<>"33\"];"], 
-		{i,1,Length[paramList[[3]]]}]	
-	];
+	WriteLine[line, ""];
+	WriteLine[line, "void "<>className<>"::getParams(double* values) const {"];
+	Do[WriteLine[line, "    values["<>ToString[i-1]<>"] = "<>comps[[i,2]]<>";"],{i,1,Length[comps]}];
+	WriteLine[line, "}"];
 	
+	WriteLine[line, ""];
+	WriteLine[line, className<>"Param "<>className<>"::paramIndex(const std::string& name) {"];
+	WriteLine[line, "    auto it = paramIndices().find(name);"];
+	WriteLine[line, "    if (it == paramIndices().end()) throw std::invalid_argument {\"Unknown parameter name \" + name + \".\"};"];
+	WriteLine[line, "    return it->second;"];
+	WriteLine[line, "}"];
+	
+	WriteLine[line, ""];
+	WriteLine[line, "const std::string& "<>className<>"::paramName("<>className<>"Param p) {"];
+	WriteLine[line, "    static const std::array<std::string, num_params> names = {"];
+	WriteLine[line, "        "<>StringRiffle[("\""<>#<>"\"")&/@comps[[All,1]],", "]];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return names.at(static_cast<int>(p));"];
 	WriteLine[line, "}"];
 ];
 
@@ -564,9 +913,7 @@ BuildPrinter[className_, paramList_, line_]:=Module[{},
 		WriteLine[line, StringJoin["    std::cout << ","\"\\n", "Vector-valued parameters", "\"", " << \"\\n\";"]];
 		WriteLine[line, StringJoin["    std::cout << ","\"", "-----------------", "\"", " << \"\\n\";"]];
 		Do[
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[2]][[i]]], "1: \" << ", ToString[paramList[[2]][[i]]], "[0] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[2]][[i]]], "2: \" << ", ToString[paramList[[2]][[i]]], "[1] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[2]][[i]]], "3: \" << ", ToString[paramList[[2]][[i]]], "[2] << \"\\n\";"]],
+			Do[WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[2]][[i]]], ToString[j], ": \" << ", ToString[paramList[[2]][[i]]], "[", ToString[j-1], "] << \"\\n\";"]],{j,1,NumFlavours}],
 		{i,1,Length[paramList[[2]]]}];
 		WriteLine[line, ""]
 	];
@@ -575,15 +922,7 @@ BuildPrinter[className_, paramList_, line_]:=Module[{},
 		WriteLine[line, StringJoin["    std::cout << ","\"\\n", "Matrix-valued parameters", "\"", " << \"\\n\";"]];
 		WriteLine[line, StringJoin["    std::cout << ","\"", "-----------------", "\"", " << \"\\n\";"]];
 		Do[
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "11: \" << ", ToString[paramList[[3]][[i]]], "[0][0] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "12: \" << ", ToString[paramList[[3]][[i]]], "[0][1] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "13: \" << ", ToString[paramList[[3]][[i]]], "[0][2] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "21: \" << ", ToString[paramList[[3]][[i]]], "[1][0] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "22: \" << ", ToString[paramList[[3]][[i]]], "[1][1] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "23: \" << ", ToString[paramList[[3]][[i]]], "[1][2] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "31: \" << ", ToString[paramList[[3]][[i]]], "[2][0] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "32: \" << ", ToString[paramList[[3]][[i]]], "[2][1] << \"\\n\";"]];
-			WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], "33: \" << ", ToString[paramList[[3]][[i]]], "[2][2] << \"\\n\";"]],
+			Do[WriteLine[line, StringJoin["    std::cout << ", "\"", ToString[paramList[[3]][[i]]], ToString[j], ToString[k], ": \" << ", ToString[paramList[[3]][[i]]], "[", ToString[j-1], "][", ToString[k-1], "] << \"\\n\";"]],{j,1,NumFlavours},{k,1,NumFlavours}],
 		{i,1,Length[paramList[[3]]]}];
 		WriteLine[line, ""]
 	];
@@ -596,8 +935,9 @@ BuildPrinter[className_, paramList_, line_]:=Module[{},
 (*Builder for a single WC function (Warsaw Basis)*)
 
 
-BuildFunctionWarsaw[modelName_,WCname_,expr_,ComplexPars_,(*YFReplRule_,*)line_]:=Module[{returnExpr},
-	returnExpr = ConvertFullExpression[expr,ComplexPars];
+BuildFunctionWarsaw[modelName_,WCname_,expr_,ComplexPars_,(*YFReplRule_,*)line_]:=Module[{returnExpr,terms},
+	returnExpr = ExpandFlavourSums[ConvertFullExpression[expr,ComplexPars]];
+	terms = TopLevelTerms[returnExpr];
 	(*If[
 		StringContainsQ[WCname,"cY"],
 		ConvertFullExpression[expr,ComplexPars],
@@ -606,7 +946,728 @@ BuildFunctionWarsaw[modelName_,WCname_,expr_,ComplexPars_,(*YFReplRule_,*)line_]
 	
 	WriteLine[line,""];
 	WriteLine[line, "double "<>modelName<>"::"<>WCname<> " {"];		
-	WriteLine[line, "    return ("<>returnExpr<>");"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\""<>WCName[WCname]<>"\");"];
+	If[Length[terms]<=MaxFunctionTerms,
+		WriteLine[line, "    return ("<>returnExpr<>");"],
+		(* the terms are added in their order, the result is the same as that of the single expression *)
+		WriteLine[line, "    double res = "<>terms[[1,2]]<>";"];
+		Do[
+			WriteLine[line, "    [&] {"];
+			WriteLine[line, "        res "<>#[[1]]<>"= "<>#[[2]]<>";"]&/@Take[terms,{first,Min[first+MaxFunctionTerms-1,Length[terms]]}];
+			WriteLine[line, "    }();"],
+		{first,2,Length[terms],MaxFunctionTerms}];
+		WriteLine[line, "    return res;"]
+	];
+	WriteLine[line, "}"];
+]
+
+
+(* ::Subsubsection:: *)
+(*Builder for the evaluation of all flavour components of a single WC function*)
+
+
+(* number of flavour indices in a prototype, "cuG(int i1, int i2, double mubarsq)" -> 2 *)
+NumFlavourIdx[prototype_] := StringCount[prototype,"int i"];
+
+(* name of the WC in a prototype, "cuG(int i1, int i2, double mubarsq)" -> "cuG" *)
+WCName[prototype_] := First[StringSplit[prototype,"("]];
+
+(* flattened row-major index of a list of flavour indices, {"i1","i2"} -> "3*i1 + i2" *)
+FlatIndex[vars_] := StringRiffle[Table[If[j==Length[vars],vars[[j]],ToString[NumFlavours^(Length[vars]-j)]<>"*"<>vars[[j]]],{j,1,Length[vars]}]," + "];
+
+(* table of the subexpressions shared between WCs: C++ expression -> {item number, offset in the workspace, free flavour indices}
+   an item with n free flavour indices occupies NumFlavours^n consecutive values of the workspace *)
+SharedTable = Association[];
+SharedSize = 0;
+SharedUsed = {};
+
+(* bounds of the terms using every item with a loop function, for the pruned evaluation (setPruning): item number -> list of
+   {WC number, TermBound}; BoundParams are all parameters in the order of the dependency bits *)
+SharedBounds = Association[];
+BoundParams = {};
+SharedWC = 0;
+
+(* bound on a term multiplying the flavour sum call: {exponents of BoundParams, C++ expression of the sums of parameters, |numerical
+   coefficient| times the number of terms of the flavour sum}, e.g. hbar g1^2 (1-cgamma^2) TwoDim[yu,r1,r2] LF[...] with one repeated
+   index -> {{..,2,..,1,..}, "1-pow(cgamma,2)", 3 hbar}; sums of vector or matrix components are not bounded, their coefficient is Infinity *)
+TermBound[term_,call_,ComplexPars_] := Module[{t,factors,sums,rest,labels,coef},
+	factors = If[Head[#]===Times, List@@#, {#}]&[term/.{LF[__]->1, Delta[__]->1, hbar->0.006332574}];
+	sums = Select[factors,!FreeQ[#,Plus]&];
+	rest = Times@@Select[factors,FreeQ[#,Plus]&];
+	labels = Union[Select[Flatten[ToExpression[First[StringCases[call,"{{"~~Except["("|")"]...~~"}}"]]]],#<10&]];
+	coef = NumFlavours^Length[labels]*Abs[N[rest/.{Mass[__]->1, TwoDim[__]->1}/.Thread[BoundParams->1]]];
+	If[!FreeQ[sums,_Mass|_TwoDim], coef = Infinity];
+	{Table[Together[t D[#,t]/#]&[rest/.{Mass[x,a_]:>t Mass[x,a], TwoDim[x,a__]:>t TwoDim[x,a], x->t x}],{x,BoundParams}],
+	 If[Length[sums]==0, "1.0", ConvertSingleTerm[Times@@sums,ComplexPars]], coef}
+];
+
+SharedRef[text_,vars_] := Module[{item},
+	If[!KeyExistsQ[SharedTable,text],
+		AppendTo[SharedTable,text->{Length[SharedTable],SharedSize,vars}];
+		SharedSize += NumFlavours^Length[vars]
+	];
+	item = SharedTable[text];
+	SharedUsed = Union[SharedUsed,{item[[1]]}];
+	"sh["<>ToString[item[[2]]]<>If[Length[vars]!=0," + "<>FlatIndex[vars],""]<>"]"
+];
+
+SharedPowRule = p:("pow(" ~~ WordCharacter.. ~~ "," ~~ DigitCharacter.. ~~ ")") :> SharedRef[p,{}];
+
+(* same as ConvertFullExpression, but the EinsSum calls and the integer powers of parameters are replaced by references into the shared workspace sh
+   returns {sorted item numbers used by the expression, converted expression} *)
+ConvertFullExpressionShared[sumOfExprs_,ComplexPars_]:=Module[{exprList,termStrs,str,pos,call,vars},
+	exprList = Which[
+		Head[sumOfExprs]===Plus, List @@ sumOfExprs,
+		Head[sumOfExprs]===Times, {sumOfExprs},
+		True, {}
+	];
+	SharedUsed = {};
+	If[Length[exprList]==0,
+		str = StringReplace[ConvertFullExpression[sumOfExprs,ComplexPars],SharedPowRule],
+		termStrs = {};
+		Do[
+			str = ConvertSingleTerm[exprList[[i]],ComplexPars];
+			(* CreateString always places the EinsSum call at the end of a term, its last argument lists the free indices *)
+			pos = StringPosition[str,"*EinsSum("];
+			If[Length[pos]!=0,
+				call = StringDrop[str,pos[[1,1]]];
+				vars = Union[StringCases[Last[StringCases[call,"{"~~Except["{"|"}"]...~~"})"]],"i"~~DigitCharacter]];
+				str = StringReplace[StringTake[str,pos[[1,1]]],SharedPowRule]<>SharedRef[call,vars];
+				If[StringContainsQ[call,"LoopFunc("],
+					SharedBounds[SharedTable[call][[1]]] = Append[Lookup[SharedBounds,SharedTable[call][[1]],{}],Prepend[TermBound[exprList[[i]],call,ComplexPars],SharedWC]]
+				],
+				str = StringReplace[str,SharedPowRule]
+			];
+			AppendTo[termStrs,str],
+		{i,1,Length[exprList]}];
+		str = StringReplace[StringRiffle[termStrs," + "],{"+ -"->"- "}]
+	];
+	Return[{Sort[SharedUsed],str}]
+];
+
+(* nested loops over the flavour indices vars around a statement or a list of statements *)
+WriteLoops[vars_,indent_,stmts_,line_] := Module[{},
+	Do[WriteLine[line, StringRepeat["    ",indent+j-1]<>"for (int "<>vars[[j]]<>" = 0; "<>vars[[j]]<>" < "<>ToString[NumFlavours]<>"; "<>vars[[j]]<>"++) {"],{j,1,Length[vars]}];
+	WriteLine[line, StringRepeat["    ",indent+Length[vars]]<>#]&/@Flatten[{stmts}];
+	Do[WriteLine[line, StringRepeat["    ",indent+j-1]<>"}"],{j,Length[vars],1,-1}];
+];
+
+(* number of characters written by builder, a function of the output stream, so that the parts can be balanced by the length of their code *)
+CodeLength[builder_] := Module[{stream=OpenWrite[],file,n},
+	builder[stream];
+	file = Close[stream];
+	n = FileByteCount[file];
+	DeleteFile[file];
+	n
+];
+
+(* part of each of a list of pieces of code with the given lengths, the largest first into the part with the least code so far *)
+LeastLoadedParts[weights_,n_] := Module[{loads=ConstantArray[0,n],parts=ConstantArray[1,Length[weights]],p},
+	Do[
+		p = First[Ordering[loads,1]];
+		parts[[k]] = p;
+		loads[[p]] += weights[[k]],
+	{k,Ordering[weights,All,Greater]}];
+	parts
+];
+
+(* part of each of a list of consecutive pieces of code with the given lengths, contiguous and filling up the parts to the same total
+   length on top of the code they already hold *)
+SourcePartOf[weights_,loads_] := Module[{n=Length[loads],targets,ends},
+	If[Length[weights]==0, Return[{}]];
+	targets = Clip[(Total[weights]+Total[loads])/n-loads,{0,Infinity}];
+	ends = Accumulate[targets]*Total[weights]/Max[Total[targets],1];
+	Min[n,1+Count[ends,e_/;e<=#]]&/@(Accumulate[weights]-weights/2)
+];
+
+(* computeShared dispatches on the item number to the parts, which hold contiguous ranges of items *)
+BuildComputeShared[modelName_,itemParts_,line_] := Module[{first},
+	WriteLine[line,""];
+	WriteLine[line, "const int "<>modelName<>"::num_shared_items = "<>ToString[Length[SharedTable]]<>";"];
+	WriteLine[line, "const int "<>modelName<>"::num_shared_values = "<>ToString[SharedSize]<>";"];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::computeShared(int k, double mubarsq, double* sh) {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\"computeShared\");"];
+	WriteLine[line, "    if (prune_tolerance > 0.0 && pruneShared(k, sh)) return;"];
+	Do[
+		first = Length[Select[itemParts,#<=i&]];
+		WriteLine[line, "    "<>If[i==1,"","else "]<>"if (k < "<>ToString[first]<>") computeShared_part"<>ToString[i]<>"(k, mubarsq, sh);"],
+	{i,1,NumSourceParts-1}];
+	WriteLine[line, "    "<>If[NumSourceParts==1,"","else "]<>"computeShared_part"<>ToString[NumSourceParts]<>"(k, mubarsq, sh);"];
+	WriteLine[line, "}"];
+];
+
+(* the case of shared item k in computeShared_partN, or in computeSharedDual_partN with the Dual parameters params *)
+WriteSharedItem[k_,dual_,params_,line_] := Module[{item=Values[SharedTable][[k]]},
+	WriteLine[line, "        case "<>ToString[item[[1]]]<>":"];
+	WriteLoops[item[[3]],3,"sh["<>ToString[item[[2]]]<>If[Length[item[[3]]]!=0," + "<>FlatIndex[item[[3]]],""]<>"] = "<>
+		If[dual, DualText[StringReplace[Keys[SharedTable][[k]],"EinsSum("->"EinsSum<num_flavours>("],params], ExpandFlavourSums[Keys[SharedTable][[k]]]]<>";",line];
+	WriteLine[line, "            break;"]
+];
+
+BuildComputeSharedPart[modelName_,part_,itemParts_,line_] := Module[{},
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::computeShared_part"<>ToString[part]<>"(int k, double mubarsq, double* sh) {"];
+	WriteLine[line, "    switch(k) {"];
+	Do[If[itemParts[[k]]==part, WriteSharedItem[k,False,{},line]],{k,1,Length[SharedTable]}];
+	WriteLine[line, "        default:"];
+	WriteLine[line, "            break;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
+];
+
+(* items needed by every WC, as a static map from the name of the WC *)
+BuildSharedItems[modelName_,sharedIds_,line_] := Module[{},
+	WriteLine[line,""];
+	WriteLine[line, "const std::map<std::string, std::vector<int> >& "<>modelName<>"::sharedItems() {"];
+	WriteLine[line, "    static const std::map<std::string, std::vector<int> > items = {"];
+	Do[WriteLine[line, "        {\""<>Keys[sharedIds][[k]]<>"\", {"<>StringRiffle[ToString/@Values[sharedIds][[k]],", "]<>"}}"<>If[k<Length[sharedIds],",",""]],{k,1,Length[sharedIds]}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return items;"];
+	WriteLine[line, "}"];
+];
+
+(* dependencies of the incremental evaluation: bit j-1 stands for the j-th parameter (vectors and matrices as a whole), the last bit for mubarsq *)
+DependencyNames[paramList_] := Join[ToString/@paramList[[1]], ToString/@paramList[[2]], ToString/@paramList[[3]], {"mubarsq"}];
+
+TextDependencies[text_,names_] := Total[Table[If[StringContainsQ[text, RegularExpression["\\b"<>names[[j]]<>"\\b"]], 2^(j-1), 0],{j,1,Length[names]}]];
+
+HexMask[n_] := "0x"<>IntegerString[n,16]<>"ull";
+
+(* masks of the shared items and of the WCs (in the order of evaluateAll, through their prefactors and the items they use), and invalidate *)
+BuildDependencies[modelName_,paramList_,sharedIds_,fillStrs_,line_] := Module[{names,itemDeps,wcDeps,comps,codes,massDeps,items},
+	names = DependencyNames[paramList];
+	If[Length[names]>64, Print["The dependency tracking supports at most 63 parameters."]; Abort[]];
+	itemDeps = TextDependencies[#,names]&/@Keys[SharedTable];
+	wcDeps = Table[BitOr[TextDependencies[fillStrs[[k]],names], Sequence@@itemDeps[[sharedIds[[k]]+1]]],{k,1,Length[fillStrs]}];
+	comps = Join[Table[i-1,{i,1,Length[paramList[[1]]]}],
+		Flatten[Table[Length[paramList[[1]]]+i-1,{i,1,Length[paramList[[2]]]},{j,1,NumFlavours}]],
+		Flatten[Table[Length[paramList[[1]]]+Length[paramList[[2]]]+i-1,{i,1,Length[paramList[[3]]]},{j,1,NumFlavours^2}]]];
+	
+	WriteLine[line,""];
+	WriteLine[line, "// bit of every parameter component in the dependency masks, the bit mubarsq_dep stands for the scale"];
+	WriteLine[line, "static const std::array<int, "<>modelName<>"::num_params> param_deps = {"<>StringRiffle[ToString/@comps,", "]<>"};"];
+	WriteLine[line, "static constexpr int mubarsq_dep = "<>ToString[Length[names]-1]<>";"];
+	
+	WriteLine[line,""];
+	WriteLine[line, "static const std::vector<unsigned long long>& sharedDeps() {"];
+	WriteLine[line, "    static const std::vector<unsigned long long> deps = {"];
+	Do[WriteLine[line, "        "<>StringRiffle[HexMask/@itemDeps[[k;;Min[k+7,Length[itemDeps]]]],", "]<>If[k+7<Length[itemDeps],",",""]],{k,1,Length[itemDeps],8}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return deps;"];
+	WriteLine[line, "}"];
+	
+	WriteLine[line,""];
+	WriteLine[line, "static const std::vector<unsigned long long>& wcDeps() {"];
+	WriteLine[line, "    static const std::vector<unsigned long long> deps = {"];
+	Do[WriteLine[line, "        "<>StringRiffle[HexMask/@wcDeps[[k;;Min[k+7,Length[wcDeps]]]],", "]<>If[k+7<Length[wcDeps],",",""]],{k,1,Length[wcDeps],8}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return deps;"];
+	WriteLine[line, "}"];
+	
+	(* pruning data: loop-function code and masses of every item, its term bounds are written to the parts by BuildPruneTablePart *)
+	codes = If[StringContainsQ[#,"LoopFunc("], ToExpression[First[StringCases[#,"LoopFunc({"~~Except["}"]...~~"},"~~c:DigitCharacter..~~",":>c]]], 0]&/@Keys[SharedTable];
+	massDeps = TextDependencies[StringRiffle[StringCases[#,"LoopFunc({"~~m:Except["}"]...~~"}":>m],","],names]&/@Keys[SharedTable];
+	items = Table["{"<>StringRiffle[{ToString[Values[SharedTable][[k,2]]],ToString[codes[[k]]],HexMask[massDeps[[k]]]},", "]<>"}",{k,1,Length[SharedTable]}];
+	
+	WriteLine[line,""];
+	WriteLine[line, "// pruned evaluation: for every shared item its first value in sh, its loop-function code (0 for items without one) and the bits of"];
+	WriteLine[line, "// the loop-function masses; the bounds on the terms using the items are in the parts, see pruneTable_part1"];
+	WriteLine[line, "struct SharedDecoupling {"];
+	WriteLine[line, "    int offset;"];
+	WriteLine[line, "    int code;"];
+	WriteLine[line, "    unsigned long long masses;"];
+	WriteLine[line, "};"];
+	WriteLine[line,""];
+	WriteLine[line, "static const std::vector<SharedDecoupling>& sharedDecoupling() {"];
+	WriteLine[line, "    static const std::vector<SharedDecoupling> items = {"];
+	Do[WriteLine[line, "        "<>StringRiffle[items[[k;;Min[k+5,Length[items]]]],", "]<>If[k+5<Length[items],",",""]],{k,1,Length[items],6}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return items;"];
+	WriteLine[line, "}"];
+	
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::invalidate(double mubarsq) {"];
+	WriteLine[line, "    std::array<double, num_params> values;"];
+	WriteLine[line, "    getParams(values.data());"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // the values are compared bitwise, so that a parameter set to the value it already has does not count as a change"];
+	WriteLine[line, "    unsigned long long changed = sh_params.empty() ? ~0ull : 0;"];
+	WriteLine[line, "    for (int p = 0; p < num_params && !sh_params.empty(); p++) if (std::memcmp(&values[p], &sh_params[p], sizeof(double)) != 0) changed |= 1ull << param_deps[p];"];
+	WriteLine[line, "    if (std::memcmp(&mubarsq, &sh_mubarsq, sizeof(double)) != 0) changed |= 1ull << mubarsq_dep;"];
+	WriteLine[line, "    if (changed == 0) return;"];
+	WriteLine[line, ""];
+	WriteLine[line, "    sh_params.assign(values.begin(), values.end());"];
+	WriteLine[line, "    sh_mubarsq = mubarsq;"];
+	WriteLine[line, "    sh_buf.resize(num_shared_values);"];
+	WriteLine[line, "    sh_valid.resize(num_shared_items, 0);"];
+	WriteLine[line, "    wc_valid.resize(wcDeps().size(), 0);"];
+	WriteLine[line, "    for (int k = 0; k < num_shared_items; k++) if (sharedDeps()[k] & changed) sh_valid[k] = 0;"];
+	WriteLine[line, "    for (std::size_t w = 0; w < wc_valid.size(); w++) if (wcDeps()[w] & changed) wc_valid[w] = 0;"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // with pruning, the items whose decision changes and the WCs using them are recomputed as well"];
+	WriteLine[line, "    if (prune_tolerance > 0.0 && !prune_frozen) decidePruning(values.data(), mubarsq);"];
+	WriteLine[line, "}"];
+];
+
+(* term bounds of every item, sorted by WC, with the bounds of equal monomials and sums merged: {WC number, exponents, sum, coefficient} *)
+ItemBounds[] := Table[SortBy[{#[[1,1]],#[[1,2]],#[[1,3]],Total[#[[;;,4]]]}&/@GatherBy[Lookup[SharedBounds,k,{}],Most],First],{k,0,Length[SharedTable]-1}];
+
+(* table of the term bounds of the items in a part, with the monomials and the sums of parameters numbered within the part *)
+BuildPruneTablePart[modelName_,part_,itemParts_,bounds_,line_] := Module[{ids,partBounds,factors,monoIds,first,rows},
+	ids = Flatten[Position[itemParts,part]];
+	partBounds = Flatten[bounds[[ids]],1];
+	factors = AssociationThread[#->Range[0,Length[#]-1]]&[DeleteDuplicates[Join[{"1.0"},partBounds[[;;,3]]]]];
+	monoIds = AssociationThread[#->Range[0,Length[#]-1]]&[DeleteDuplicates[partBounds[[;;,2]]]];
+	first = Accumulate[Prepend[Length/@bounds[[ids]],0]];
+	(* the coefficients with all their digits, so that the bounds are not rounded down *)
+	rows = ("{"<>StringRiffle[{ToString[#[[1]]],ToString[monoIds[#[[2]]]],ToString[factors[#[[3]]]],If[#[[4]]===Infinity,"INFINITY",StringReplace[ToString[#[[4]],InputForm],"*^"->"e"]]},", "]<>"}")&/@partBounds;
+	
+	WriteLine[line,""];
+	WriteLine[line, "// pruned evaluation: bounds on the terms using the shared items of this part, see "<>modelName<>"::PruneTable"];
+	WriteLine[line, "const "<>modelName<>"::PruneTable& "<>modelName<>"::pruneTable_part"<>ToString[part]<>"() {"];
+	WriteLine[line, "    static const PruneTable table = {"<>ToString[Length[Select[itemParts,#<part&]]]<>", "<>ToString[Length[Select[itemParts,#<=part&]]]<>","];
+	WriteLine[line, "        {"];
+	Do[WriteLine[line, "            "<>StringRiffle[ToString/@first[[k;;Min[k+15,Length[first]]]],", "]<>If[k+15<Length[first],",",""]],{k,1,Length[first],16}];
+	WriteLine[line, "        },"];
+	WriteLine[line, "        {"];
+	Do[WriteLine[line, "            "<>StringRiffle[rows[[k;;Min[k+3,Length[rows]]]],", "]<>If[k+3<Length[rows],",",""]],{k,1,Length[rows],4}];
+	WriteLine[line, "        },"];
+	WriteLine[line, "        {"];
+	Do[WriteLine[line, "            {"<>StringRiffle[ToString/@Keys[monoIds][[k]],", "]<>"}"<>If[k<Length[monoIds],",",""]],{k,1,Length[monoIds]}];
+	WriteLine[line, "        }"];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    return table;"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::pruneFactors_part"<>ToString[part]<>"(std::vector<double>& factors) const {"];
+	WriteLine[line, "    factors = {"];
+	Do[WriteLine[line, "        "<>If[k==1, Keys[factors][[k]], "std::abs("<>Keys[factors][[k]]<>")"]<>If[k<Length[factors],",",""]],{k,1,Length[factors]}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "}"];
+];
+
+(* tolerance, counter and decisions of the pruned evaluation, with the tables of BuildDependencies and BuildPruneTablePart *)
+BuildPruning[modelName_,line_] := Module[{},
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::setPruning(double tolerance) {"];
+	WriteLine[line, "    if (!(tolerance >= 0.0)) throw std::invalid_argument {\"The pruning tolerance has to be non-negative.\"};"];
+	WriteLine[line, "    prune_tolerance = tolerance;"];
+	WriteLine[line, "    // the next evaluation recomputes everything with the new tolerance"];
+	WriteLine[line, "    sh_params.clear();"];
+	WriteLine[line, "    sh_pruned.assign(num_shared_items, 0);"];
+	WriteLine[line, "    num_pruned = 0;"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "double "<>modelName<>"::pruningTolerance() const {"];
+	WriteLine[line, "    return prune_tolerance;"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "std::size_t "<>modelName<>"::prunedTerms() const {"];
+	WriteLine[line, "    return num_pruned;"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::decidePruning(const double* values, double mubarsq) {"];
+	WriteLine[line, "    prune_min.assign(mubarsq_dep, INFINITY);"];
+	WriteLine[line, "    prune_max.assign(mubarsq_dep, 0.0);"];
+	WriteLine[line, "    for (int p = 0; p < num_params; p++) {"];
+	WriteLine[line, "        prune_min[param_deps[p]] = std::min(prune_min[param_deps[p]], std::abs(values[p]));"];
+	WriteLine[line, "        prune_max[param_deps[p]] = std::max(prune_max[param_deps[p]], std::abs(values[p]));"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "    if (sh_pruned.empty()) sh_pruned.assign(num_shared_items, 0);"];
+	WriteLine[line, ""];
+	WriteLine[line, "    // the bounds of the pruned items add up in every WC, the items are taken in order while the sums stay below tolerance"];
+	WriteLine[line, "    std::vector<double> used(wcDeps().size(), 0.0);"];
+	WriteLine[line, "    std::vector<double> factors;"];
+	Do[
+		WriteLine[line, "    pruneFactors_part"<>ToString[i]<>"(factors);"];
+		WriteLine[line, "    prunePart(pruneTable_part"<>ToString[i]<>"(), factors, mubarsq, used);"],
+	{i,1,NumSourceParts}];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::prunePart(const PruneTable& table, const std::vector<double>& factors, double mubarsq, std::vector<double>& used) {"];
+	WriteLine[line, "    // the monomials with the largest components for positive powers of a parameter and the smallest ones for negative powers"];
+	WriteLine[line, "    std::vector<double> monomials(table.monomials.size(), 1.0);"];
+	WriteLine[line, "    for (std::size_t m = 0; m < monomials.size(); m++) for (int b = 0; b < mubarsq_dep; b++) {"];
+	WriteLine[line, "        const int power = table.monomials[m][b];"];
+	WriteLine[line, "        if (power > 0) monomials[m] *= std::pow(prune_max[b], power);"];
+	WriteLine[line, "        else if (power < 0) monomials[m] /= std::pow(prune_min[b], -power);"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    std::vector<std::pair<int, double> > sums;"];
+	WriteLine[line, "    for (int k = table.first_item; k < table.end_item; k++) {"];
+	WriteLine[line, "        const SharedDecoupling& item = sharedDecoupling()[k];"];
+	WriteLine[line, "        const int first = table.item_bounds[k - table.first_item];"];
+	WriteLine[line, "        const int end = table.item_bounds[k - table.first_item + 1];"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // heavy: the lightest component of the heaviest loop-function mass, light and top: the lightest and the heaviest component of all"];
+	WriteLine[line, "        double heavy = 0.0, light = INFINITY, top = 0.0;"];
+	WriteLine[line, "        for (int b = 0; b < mubarsq_dep; b++) if (item.masses >> b & 1) {"];
+	WriteLine[line, "            heavy = std::max(heavy, prune_min[b]);"];
+	WriteLine[line, "            light = std::min(light, prune_min[b]);"];
+	WriteLine[line, "            top = std::max(top, prune_max[b]);"];
+	WriteLine[line, "        }"];
+	WriteLine[line, "        bool prune = item.code != 0 && light > 0.0;"];
+	WriteLine[line, ""];
+	WriteLine[line, "        if (prune) {"];
+	WriteLine[line, "            // bound on the loop function of mass dimension d, see lfBound"];
+	WriteLine[line, "            const int d = lfDimension(item.code);"];
+	WriteLine[line, "            const double logs = 1.0 + std::max(std::abs(std::log(mubarsq/(light*light))), std::abs(std::log(mubarsq/(top*top)))) + 2.0*std::log(top/light);"];
+	WriteLine[line, "            const double size = lfBound(item.code)*logs*(d >= 0 ? std::pow(top, d) : std::max(std::pow(heavy, d), std::pow(light, d + 2)/(heavy*heavy)));"];
+	WriteLine[line, "            // the bounds are sorted by WC, the item is pruned if every WC stays below tolerance with the items pruned before"];
+	WriteLine[line, "            sums.clear();"];
+	WriteLine[line, "            for (int i = first; i < end; i++) {"];
+	WriteLine[line, "                const TermBound& bound = table.bounds[i];"];
+	WriteLine[line, "                if (sums.empty() || sums.back().first != bound.wc) sums.emplace_back(bound.wc, 0.0);"];
+	WriteLine[line, "                sums.back().second += size*bound.coefficient*factors[bound.factor]*monomials[bound.monomial];"];
+	WriteLine[line, "            }"];
+	WriteLine[line, "            for (const auto& [w, sum] : sums) prune = prune && used[w] + sum < prune_tolerance;"];
+	WriteLine[line, "            if (prune) for (const auto& [w, sum] : sums) used[w] += sum;"];
+	WriteLine[line, "        }"];
+	WriteLine[line, ""];
+	WriteLine[line, "        // an item whose decision changes is recomputed, and so are the WCs using it"];
+	WriteLine[line, "        if (prune != static_cast<bool>(sh_pruned[k])) {"];
+	WriteLine[line, "            if (prune) num_pruned++;"];
+	WriteLine[line, "            else num_pruned--;"];
+	WriteLine[line, "            sh_pruned[k] = prune;"];
+	WriteLine[line, "            sh_valid[k] = 0;"];
+	WriteLine[line, "            for (int i = first; i < end; i++) wc_valid[table.bounds[i].wc] = 0;"];
+	WriteLine[line, "        }"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, "bool "<>modelName<>"::pruneShared(int k, double* sh) {"];
+	WriteLine[line, "    if (!sh_pruned[k]) return false;"];
+	WriteLine[line, "    std::fill(sh + sharedDecoupling()[k].offset, sh + (k + 1 < num_shared_items ? sharedDecoupling()[k + 1].offset : num_shared_values), 0.0);"];
+	WriteLine[line, "    return true;"];
+	WriteLine[line, "}"];
+];
+
+BuildFunctionWarsawFill[modelName_,WCprototype_,exprStr_,line_]:=Module[{vars},
+	vars = Table["i"<>ToString[j],{j,1,NumFlavourIdx[WCprototype]}];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::"<>WCName[WCprototype]<>"_fill(double mubarsq, const double* sh, double* out) {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\""<>WCName[WCprototype]<>"_fill\");"];
+	If[Length[vars]==0,
+		WriteLine[line, "    out[0] = ("<>exprStr<>");"],
+		WriteLoops[vars,1,"out["<>FlatIndex[vars]<>"] = ("<>exprStr<>");",line]
+	];
+	WriteLine[line, "}"];
+]
+
+BuildFunctionWarsawAll[modelName_,WCprototype_,line_]:=Module[{name},
+	If[NumFlavourIdx[WCprototype]==0, Return[]];
+	name = WCName[WCprototype];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::"<>name<>"_all(double mubarsq, double* out) {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\""<>name<>"_all\");"];
+	WriteLine[line, "    invalidate(mubarsq);"];
+	WriteLine[line, "    for (int k : sharedItems().at(\""<>name<>"\")) if (!sh_valid[k]) {"];
+	WriteLine[line, "        computeShared(k, mubarsq, sh_buf.data());"];
+	WriteLine[line, "        sh_valid[k] = 1;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "    "<>name<>"_fill(mubarsq, sh_buf.data(), out);"];
+	WriteLine[line, "}"];
+]
+
+(* where the fill method of a WC writes into an object res of the coefficient struct *)
+CoefficientTarget[WCprototype_,obj_:"res"] := If[NumFlavourIdx[WCprototype]==0, "&"<>obj<>"."<>WCName[WCprototype], obj<>"."<>WCName[WCprototype]<>".data()"];
+
+BuildEvaluate[modelName_,WCprototypes_,line_]:=Module[{},
+	WriteLine[line,""];
+	WriteLine[line, "const std::vector<std::string>& "<>modelName<>"::wcNames() {"];
+	WriteLine[line, "    static const std::vector<std::string> names = {"<>StringRiffle[("\""<>WCName[#]<>"\"")&/@WCprototypes,", "]<>"};"];
+	WriteLine[line, "    return names;"];
+	WriteLine[line, "}"];
+	WriteLine[line,""];
+	WriteLine[line, modelName<>"Coefficients "<>modelName<>"::evaluateAll(double mubarsq) {"];
+	WriteLine[line, "    invalidate(mubarsq);"];
+	WriteLine[line, "    for (int k = 0; k < num_shared_items; k++) if (!sh_valid[k]) {"];
+	WriteLine[line, "        computeShared(k, mubarsq, sh_buf.data());"];
+	WriteLine[line, "        sh_valid[k] = 1;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	Do[
+		WriteLine[line, "    if (!wc_valid["<>ToString[k-1]<>"]) "<>WCName[WCprototypes[[k]]]<>"_fill(mubarsq, sh_buf.data(), "<>CoefficientTarget[WCprototypes[[k]],"wc_buf"]<>");"],
+	{k,1,Length[WCprototypes]}];
+	WriteLine[line, "    std::fill(wc_valid.begin(), wc_valid.end(), 1);"];
+	WriteLine[line, ""];
+	WriteLine[line, "    return wc_buf;"];
+	WriteLine[line, "}"];
+	
+	WriteLine[line,""];
+	WriteLine[line, modelName<>"Coefficients "<>modelName<>"::evaluate(double mubarsq, const std::vector<std::string>& wc_names) {"];
+	WriteLine[line, "    "<>modelName<>"Coefficients res;"];
+	WriteLine[line, "    std::vector<char> needed(num_shared_items, 0);"];
+	WriteLine[line, ""];
+	WriteLine[line, "    for (const std::string& name : wc_names) {"];
+	WriteLine[line, "        if (!sharedItems().contains(name)) throw std::invalid_argument {\"Unknown WC name \" + name + \".\"};"];
+	WriteLine[line, "        for (int k : sharedItems().at(name)) needed[k] = 1;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    invalidate(mubarsq);"];
+	WriteLine[line, "    for (int k = 0; k < num_shared_items; k++) if (needed[k] && !sh_valid[k]) {"];
+	WriteLine[line, "        computeShared(k, mubarsq, sh_buf.data());"];
+	WriteLine[line, "        sh_valid[k] = 1;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    for (const std::string& name : wc_names) {"];
+	Do[WriteLine[line, "        "<>If[k==1,"if","else if"]<>" (name == \""<>WCName[WCprototypes[[k]]]<>"\") "<>WCName[WCprototypes[[k]]]<>"_fill(mubarsq, sh_buf.data(), "<>CoefficientTarget[WCprototypes[[k]]]<>");"],{k,1,Length[WCprototypes]}];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    return res;"];
+	WriteLine[line, "}"];
+]
+
+
+(* ::Subsubsection:: *)
+(*Builder for the split of the WCs into a + b*log(mubarsq)*)
+
+
+(* statements for one WC, looping over the flavour components of the arrays *)
+ScaleStatements[WCprototype_,stmts_] := Module[{n=NumFlavourIdx[WCprototype],name=WCName[WCprototype],comp},
+	comp[x_] := x<>"."<>name<>If[n==0,"","[k]"];
+	If[n==0,
+		("    "<>#)&/@stmts[comp],
+		Join[{"    for (int k = 0; k < "<>ToString[NumFlavours^n]<>"; k++) {"},("        "<>#)&/@stmts[comp],{"    }"}]
+	]
+];
+
+BuildScaleCoefficients[modelName_,WCprototypes_,line_]:=Module[{},
+	WriteLine[line,""];
+	WriteLine[line, modelName<>"ScaleCoefficients "<>modelName<>"::evaluateScales(double mubarsq) {"];
+	WriteLine[line, "    // the scales differ by a power of two, so that mubarsq/m^2 in the loop functions changes by exactly that factor; with pruning,"];
+	WriteLine[line, "    // the second scale keeps the pruned items of the first, so that both describe the same terms"];
+	WriteLine[line, "    const "<>modelName<>"Coefficients c1 = evaluateAll(mubarsq);"];
+	WriteLine[line, "    prune_frozen = true;"];
+	WriteLine[line, "    const "<>modelName<>"Coefficients c2 = evaluateAll(4*mubarsq);"];
+	WriteLine[line, "    prune_frozen = false;"];
+	WriteLine[line, "    const double lg = log(mubarsq);"];
+	WriteLine[line, "    const double dlg = log(4.0);"];
+	WriteLine[line, "    "<>modelName<>"ScaleCoefficients res;"];
+	WriteLine[line, ""];
+	Do[WriteLine[line, #]&/@ScaleStatements[WCprototypes[[k]],
+		{#["res.b"]<>" = ("<>#["c2"]<>" - "<>#["c1"]<>")/dlg;", #["res.a"]<>" = "<>#["c1"]<>" - "<>#["res.b"]<>"*lg;"}&],{k,1,Length[WCprototypes]}];
+	WriteLine[line, ""];
+	WriteLine[line, "    return res;"];
+	WriteLine[line, "}"];
+	
+	WriteLine[line,""];
+	WriteLine[line, modelName<>"Coefficients "<>modelName<>"ScaleCoefficients::at(double mubarsq) const {"];
+	WriteLine[line, "    const double lg = log(mubarsq);"];
+	WriteLine[line, "    "<>modelName<>"Coefficients res;"];
+	WriteLine[line, ""];
+	Do[WriteLine[line, #]&/@ScaleStatements[WCprototypes[[k]],
+		{#["res"]<>" = "<>#["a"]<>" + "<>#["b"]<>"*lg;"}&],{k,1,Length[WCprototypes]}];
+	WriteLine[line, ""];
+	WriteLine[line, "    return res;"];
+	WriteLine[line, "}"];
+]
+
+
+(* ::Subsubsection:: *)
+(*Builders for the batched WC functions*)
+
+
+BuildBatchStruct[className_,paramList_,line_]:=Module[{cols},
+	cols = Flatten[ParamColumns[paramList]];
+	WriteLine[line, ""];
+	WriteLine[line, className<>"Batch::"<>className<>"Batch(std::size_t n, const std::map<std::string, double>& params) {"];
+	WriteLine[line, "    this->size = n;"];
+	Do[WriteLine[line, "    this->"<>cols[[i]]<>".assign(n, params.contains(\""<>cols[[i]]<>"\") ? params.at(\""<>cols[[i]]<>"\") : 0.0);"],{i,1,Length[cols]}];
+	WriteLine[line, "}"];
+];
+
+BuildLoadBatchPoint[className_,paramList_,line_]:=Module[{cols},
+	(* one line for the scalar parameters and one for every vector and matrix, in the order of the parameter enum *)
+	cols = StringRiffle[("points."<>#<>"[n]")&/@#,", "]&/@Select[Join[{ParamColumns[paramList][[1]]},ParamColumns[paramList][[2]],ParamColumns[paramList][[3]]],Length[#]!=0&];
+	WriteLine[line, ""];
+	WriteLine[line, "void "<>className<>"::loadBatchPoint(const "<>className<>"Batch& points, std::size_t n, double mubarsq, const std::vector<int>& items, std::size_t lane) {"];
+	WriteLine[line, "    const std::array<double, num_params> values = {"];
+	Do[WriteLine[line, "        "<>cols[[i]]<>If[i<Length[cols],",",""]],{i,1,Length[cols]}];
+	WriteLine[line, "    };"];
+	WriteLine[line, "    setParams(values.data());"];
+	WriteLine[line, "    invalidate(mubarsq);"];
+	WriteLine[line, ""];
+	WriteLine[line, "    std::size_t row = 0;"];
+	WriteLine[line, "    for (int k : items) {"];
+	WriteLine[line, "        if (!sh_valid[k]) {"];
+	WriteLine[line, "            computeShared(k, mubarsq, sh_buf.data());"];
+	WriteLine[line, "            sh_valid[k] = 1;"];
+	WriteLine[line, "        }"];
+	WriteLine[line, "        const int end = k + 1 < num_shared_items ? sharedDecoupling()[k + 1].offset : num_shared_values;"];
+	WriteLine[line, "        for (int v = sharedDecoupling()[k].offset; v < end; v++) sh_batch[(row++)*batch_block + lane] = sh_buf[v];"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
+];
+
+(* the expression of a WC fill method for the lane n of a batch: the values of the shared items in items are the first rows of sb (see
+   loadBatchPoint), followed by one row for every pow/sqrt call and every scalar parameter outside of them, which are evaluated per point;
+   KronDelta of flavour indices becomes a comparison; returns {expressions of the rows after the shared items, expression of lane n} *)
+BatchCallPattern = RegularExpression["\\b(?:pow|sqrt)(\\((?:[^()]|(?1))*\\))"];
+
+BatchExpression[exprStr_,items_,scalarParams_] := Module[{entries,base,rows,calls,params,str},
+	entries = Values[SharedTable][[#+1]]&/@items;
+	base = AssociationThread[ToString/@entries[[;;,2]], Most[Prepend[Accumulate[NumFlavours^Length[#[[3]]]&/@entries],0]]];
+	rows = Total[NumFlavours^Length[#[[3]]]&/@entries];
+	calls = DeleteDuplicates[StringCases[exprStr,BatchCallPattern]];
+	str = StringReplace[exprStr,Table[calls[[j]]->"sb["<>ToString[rows+j-1]<>"*batch_block + n]",{j,1,Length[calls]}]];
+	params = DeleteDuplicates[StringCases[str,WordBoundary~~p:(Alternatives@@scalarParams)~~WordBoundary:>p]];
+	str = StringReplace[str,WordBoundary~~p:(Alternatives@@scalarParams)~~WordBoundary:>"sb["<>ToString[rows+Length[calls]+First[FirstPosition[params,p]]-1]<>"*batch_block + n]"];
+	str = StringReplace[str,"sh["~~off:DigitCharacter..~~flat:Except["]"]...~~"]":>"sb["<>If[flat=="",ToString[base[off]],"("<>ToString[base[off]]<>flat<>")"]<>"*batch_block + n]"];
+	str = StringReplace[str,"KronDelta("~~a:WordCharacter..~~","~~b:WordCharacter..~~")":>"("<>a<>" == "<>b<>")"];
+	Return[{Join[StringReplace[calls,"sh["->"sh_buf["],params],str}]
+];
+
+BuildFunctionWarsawBatch[modelName_,WCprototype_,exprStr_,items_,scalarParams_,line_]:=Module[{name,vars,rows,lanes,target},
+	name = WCName[WCprototype];
+	vars = Table["i"<>ToString[j],{j,1,NumFlavourIdx[WCprototype]}];
+	rows = Total[NumFlavours^Length[Values[SharedTable][[#+1,3]]]&/@items];
+	lanes = BatchExpression[exprStr,items,scalarParams];
+	target = If[Length[vars]==0, "out + first", "out + ("<>FlatIndex[vars]<>")*points.size + first"];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::"<>name<>"_batch(const "<>modelName<>"Batch& points, double mubarsq, double* out) {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\""<>name<>"_batch\");"];
+	WriteLine[line, "    const std::vector<int>& items = sharedItems().at(\""<>name<>"\");"];
+	WriteLine[line, "    std::array<double, num_params> saved;"];
+	WriteLine[line, "    getParams(saved.data());"];
+	(* a WC without terms, which vanishes, has no rows in the workspace *)
+	If[rows+Length[lanes[[1]]]!=0,
+		WriteLine[line, "    sh_batch.resize("<>ToString[rows+Length[lanes[[1]]]]<>"*batch_block);"];
+		WriteLine[line, "    double* sb = sh_batch.data();"]
+	];
+	WriteLine[line, "    for (std::size_t first = 0; first < points.size; first += batch_block) {"];
+	WriteLine[line, "        // the values of every point, the last point fills up the block"];
+	WriteLine[line, "        for (std::size_t n = 0; n < batch_block; n++) {"];
+	WriteLine[line, "            loadBatchPoint(points, std::min(first + n, points.size - 1), mubarsq, items, n);"];
+	Do[WriteLine[line, "            sb["<>ToString[rows+j-1]<>"*batch_block + n] = "<>lanes[[1,j]]<>";"],{j,1,Length[lanes[[1]]]}];
+	WriteLine[line, "        }"];
+	WriteLine[line, "        const std::size_t num = std::min(batch_block, points.size - first);"];
+	WriteLoops[vars,2,{
+		"std::array<double, batch_block> res;",
+		"for (std::size_t n = 0; n < batch_block; n++) res[n] = ("<>lanes[[2]]<>");",
+		"std::copy(res.begin(), res.begin() + num, "<>target<>");"},line];
+	WriteLine[line, "    }"];
+	WriteLine[line, "    setParams(saved.data());"];
+	WriteLine[line, "}"];
+]
+
+
+(* ::Subsubsection:: *)
+(*Builders for the derivatives on dual numbers*)
+
+
+(* a generated expression on the Dual parameters p of the derivatives: the parameters become members of p, LoopFunc and MassPow their
+   Dual counterparts *)
+DualText[str_,params_] := StringReplace[str,{"LoopFunc("->"DualLoopFunc(", "MassPow("->"DualMassPow(", WordBoundary~~q:(Alternatives@@params)~~WordBoundary:>"p."<>q}];
+
+(* the terms of a sum at the top level of a C++ expression, as {"+", term} or {"-", term} *)
+TopLevelTerms[str_] := Module[{chars=Characters[str],depth=0,cuts},
+	cuts = Reap[Do[
+		Switch[chars[[j]],
+			"("|"["|"{", depth++,
+			")"|"]"|"}", depth--,
+			" ", If[depth==0 && j+2<=Length[chars] && MemberQ[{"+","-"},chars[[j+1]]] && chars[[j+2]]==" ", Sow[j]]
+		],
+	{j,1,Length[chars]}]][[2]];
+	cuts = If[cuts==={}, {}, First[cuts]];
+	Table[{If[k==1,"+",chars[[cuts[[k-1]]+1]]], StringTake[str,{If[k==1,1,cuts[[k-1]]+3],If[k<=Length[cuts],cuts[[k]]-1,-1]}]},{k,1,Length[cuts]+1}]
+];
+
+(* the Dual counterparts of computeShared always go through EinsSum, whatever FlavourSumMode *)
+BuildComputeSharedDual[modelName_,itemParts_,line_] := Module[{first},
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::computeSharedDual(int k, double mubarsq, const DualParams& p, Dual* sh) const {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\"computeSharedDual\");"];
+	Do[
+		first = Length[Select[itemParts,#<=i&]];
+		WriteLine[line, "    "<>If[i==1,"","else "]<>"if (k < "<>ToString[first]<>") computeSharedDual_part"<>ToString[i]<>"(k, mubarsq, p, sh);"],
+	{i,1,NumSourceParts-1}];
+	WriteLine[line, "    "<>If[NumSourceParts==1,"","else "]<>"computeSharedDual_part"<>ToString[NumSourceParts]<>"(k, mubarsq, p, sh);"];
+	WriteLine[line, "}"];
+];
+
+BuildComputeSharedDualPart[modelName_,part_,itemParts_,params_,line_] := Module[{},
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::computeSharedDual_part"<>ToString[part]<>"(int k, double mubarsq, const DualParams& p, Dual* sh) const {"];
+	WriteLine[line, "    switch(k) {"];
+	Do[If[itemParts[[k]]==part, WriteSharedItem[k,True,params,line]],{k,1,Length[SharedTable]}];
+	WriteLine[line, "        default:"];
+	WriteLine[line, "            break;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
+];
+
+(* the terms are added one statement at a time, so that the temporaries of a long expression do not pile up on the stack *)
+BuildFunctionWarsawFillDual[modelName_,WCprototype_,exprStr_,params_,line_]:=Module[{vars,stmts},
+	vars = Table["i"<>ToString[j],{j,1,NumFlavourIdx[WCprototype]}];
+	stmts = Join[{"Dual& res = out["<>If[Length[vars]==0,"0",FlatIndex[vars]]<>"];", "res = 0.0;"},
+		("res "<>#[[1]]<>"= "<>DualText[#[[2]],params]<>";")&/@TopLevelTerms[exprStr]];
+	WriteLine[line,""];
+	WriteLine[line, "void "<>modelName<>"::"<>WCName[WCprototype]<>"_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const {"];
+	WriteLine[line, "    OPERATOR_PROFILE_SCOPE(\""<>WCName[WCprototype]<>"_fillDual\");"];
+	WriteLoops[vars,1,stmts,line];
+	WriteLine[line, "}"];
+]
+
+BuildDerivatives[modelName_,paramList_,WCprototypes_,line_]:=Module[{comps,k=0},
+	(* one line for the scalar parameters and one for every vector and matrix, in the order of the parameter enum *)
+	comps = Join[
+		Table["p."<>ToString[paramList[[1]][[i]]]<>" = d["<>ToString[k++]<>"];",{i,1,Length[paramList[[1]]]}],
+		Table["p."<>ToString[paramList[[2]][[i]]]<>" = {"<>StringRiffle[Table["d["<>ToString[k++]<>"]",{j,1,NumFlavours}],", "]<>"};",{i,1,Length[paramList[[2]]]}],
+		Table["p."<>ToString[paramList[[3]][[i]]]<>" = {{"<>StringRiffle[Table["{"<>StringRiffle[Table["d["<>ToString[k++]<>"]",{c,1,NumFlavours}],", "]<>"}",{r,1,NumFlavours}],", "]<>"}};",{i,1,Length[paramList[[3]]]}]
+	];
+	WriteLine[line, ""];
+	WriteLine[line, "// the components of a WC in the coefficient struct, for derivatives"];
+	WriteLine[line, "static std::span<double> wcComponents(double& wc) { return {&wc, 1}; }"];
+	WriteLine[line, ""];
+	WriteLine[line, "template <std::size_t N>"];
+	WriteLine[line, "static std::span<double> wcComponents(std::array<double, N>& wc) { return wc; }"];
+	WriteLine[line, ""];
+	WriteLine[line, "// stores the values and the derivatives of the components of a WC, whose derivatives were taken in the directions first, first + 1, ..."];
+	WriteLine[line, "template <class T>"];
+	WriteLine[line, "static void storeDual(const std::vector<Dual>& out, T "<>modelName<>"Coefficients::* wc, std::size_t first, "<>modelName<>"Derivatives& res) {"];
+	WriteLine[line, "    const std::span<double> value = wcComponents(res.value.*wc);"];
+	WriteLine[line, "    for (std::size_t c = 0; c < value.size(); c++) value[c] = out[c].val;"];
+	WriteLine[line, "    for (std::size_t j = first; j < res.gradient.size() && j < first + dual_directions; j++) {"];
+	WriteLine[line, "        const std::span<double> der = wcComponents(res.gradient[j].*wc);"];
+	WriteLine[line, "        for (std::size_t c = 0; c < der.size(); c++) der[c] = out[c].der[j - first];"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "}"];
+	WriteLine[line, ""];
+	WriteLine[line, "void "<>modelName<>"::dualParams(const std::vector<"<>modelName<>"Param>& directions, std::size_t first, DualParams& p) const {"];
+	WriteLine[line, "    std::array<double, num_params> values;"];
+	WriteLine[line, "    getParams(values.data());"];
+	WriteLine[line, "    std::array<Dual, num_params> d;"];
+	WriteLine[line, "    for (int k = 0; k < num_params; k++) d[k] = values[k];"];
+	WriteLine[line, "    for (std::size_t j = first; j < directions.size() && j < first + dual_directions; j++) d[static_cast<int>(directions[j])].der[j - first] = 1.0;"];
+	WriteLine[line, ""];
+	Do[WriteLine[line, "    "<>c],{c,comps}];
+	WriteLine[line, "}"];
+	WriteLine[line, ""];
+	WriteLine[line, modelName<>"Derivatives "<>modelName<>"::derivatives(double mubarsq, const std::vector<std::string>& wc_names, const std::vector<"<>modelName<>"Param>& directions) {"];
+	WriteLine[line, "    "<>modelName<>"Derivatives res;"];
+	WriteLine[line, "    res.gradient.resize(directions.size());"];
+	WriteLine[line, "    std::vector<char> needed(num_shared_items, 0);"];
+	WriteLine[line, ""];
+	WriteLine[line, "    for (const std::string& name : wc_names) {"];
+	WriteLine[line, "        if (!sharedItems().contains(name)) throw std::invalid_argument {\"Unknown WC name \" + name + \".\"};"];
+	WriteLine[line, "        for (int k : sharedItems().at(name)) needed[k] = 1;"];
+	WriteLine[line, "    }"];
+	WriteLine[line, ""];
+	WriteLine[line, "    DualParams p;"];
+	WriteLine[line, "    std::vector<Dual> out("<>ToString[NumFlavours^Max[NumFlavourIdx/@WCprototypes]]<>");"];
+	WriteLine[line, "    sh_dual.resize(num_shared_values);"];
+	WriteLine[line, "    // one pass for every dual_directions directions, and one for the values alone if there are none"];
+	WriteLine[line, "    for (std::size_t first = 0; first == 0 || first < directions.size(); first += dual_directions) {"];
+	WriteLine[line, "        dualParams(directions, first, p);"];
+	WriteLine[line, "        for (int k = 0; k < num_shared_items; k++) if (needed[k]) computeSharedDual(k, mubarsq, p, sh_dual.data());"];
+	WriteLine[line, ""];
+	WriteLine[line, "        for (const std::string& name : wc_names) {"];
+	Do[WriteLine[line, "            "<>If[k==1,"if","else if"]<>" (name == \""<>WCName[WCprototypes[[k]]]<>"\") { "<>WCName[WCprototypes[[k]]]<>"_fillDual(mubarsq, p, sh_dual.data(), out.data()); storeDual(out, &"<>modelName<>"Coefficients::"<>WCName[WCprototypes[[k]]]<>", first, res); }"],{k,1,Length[WCprototypes]}];
+	WriteLine[line, "        }"];
+	WriteLine[line, "    }"];
+	WriteLine[line, "    return res;"];
 	WriteLine[line, "}"];
 ]
 
@@ -639,25 +1700,84 @@ ReplaceVarName[list_,str_] := Module[{rules},
 ];
 
 
-SourceFileBuilder[modelName_, paramList_, ComplexPars_, matchingOutput_]:=Module[{keyList, exprList, path, (*YFReplRule,*) line1},
+SourceFileBuilder[modelName_, paramList_, ComplexPars_, matchingOutput_]:=Module[{keyList, exprList, path, (*YFReplRule,*) sharedRes, params, wcWeights, itemWeights, itemParts, wcParts, bounds, line1},
 	keyList=Keys[matchingOutput];
 	exprList=Values[matchingOutput];
+	VectorParams = ToString/@paramList[[2]];
+	
+	(*YFReplRule = ReplaceVarName[paramList[[4]],"_"];*)
+	
+	(* subexpressions shared between WCs (EinsSum contractions and powers of parameters) are collected in a table
+	   and evaluated once per parameter point by evaluateAll, evaluate and the _all methods *)
+	SharedTable = Association[];
+	SharedSize = 0;
+	SharedBounds = Association[];
+	BoundParams = Join[paramList[[1]],paramList[[2]],paramList[[3]]];
+	sharedRes = Table[SharedWC = k-1; ConvertFullExpressionShared[exprList[[k]],ComplexPars],{k,1,Length[matchingOutput]}];
+	
+	(* the WC functions and the shared subexpressions are split over the parts by the length of all the code written for them, with about
+	   44 characters per row of the pruning table of an item: the WCs one by one into the part with the least code, then the items in
+	   contiguous ranges that fill the parts up to the same length; everything else goes to lib/<model>.cpp *)
+	bounds = ItemBounds[];
+	params = Most[DependencyNames[paramList]];
+	wcWeights = Table[CodeLength[(
+		BuildFunctionWarsaw[modelName,WarsawAll[keyList[[k]]],exprList[[k]],ComplexPars,#];
+		BuildFunctionWarsawFill[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],#];
+		BuildFunctionWarsawAll[modelName,WarsawAll[keyList[[k]]],#];
+		BuildFunctionWarsawBatch[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],sharedRes[[k,1]],ToString/@paramList[[1]],#];
+		BuildFunctionWarsawFillDual[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],params,#])&],
+	{k,1,Length[matchingOutput]}];
+	wcParts = LeastLoadedParts[wcWeights,NumSourceParts];
+	itemWeights = Table[CodeLength[(WriteSharedItem[k,False,{},#]; WriteSharedItem[k,True,params,#])&]+44*Length[bounds[[k]]],{k,1,Length[SharedTable]}];
+	itemParts = SourcePartOf[itemWeights,Table[Total[Pick[wcWeights,wcParts,part]],{part,1,NumSourceParts}]];
 	
 	path = FileNameJoin[{NotebookDirectory[],"lib"}];
-	line1 = OpenWrite[path<>"/"<>modelName<>".cpp"];
+	(* parts left over from a generation with a larger NumSourceParts would be linked in as well *)
+	Quiet[DeleteFile[FileNames[modelName<>"_part*.cpp",path]]];
 	
+	line1 = OpenWrite[path<>"/"<>modelName<>".cpp"];
 	BuildPreprocessorDirectives[modelName,line1];
 	BuildConstructor[modelName,paramList,line1];
 	BuildUpdater[modelName,paramList,line1];
+	BuildParamAccess[modelName,paramList,line1];
 	BuildPrinter[modelName,paramList,line1];
-	
-	(*YFReplRule = ReplaceVarName[paramList[[4]],"_"];*)
+	BuildComputeShared[modelName,itemParts,line1];
+	BuildSharedItems[modelName,AssociationThread[WCName/@(WarsawAll/@keyList),First/@sharedRes],line1];
+	BuildDependencies[modelName,paramList,First/@sharedRes,Last/@sharedRes,line1];
+	BuildPruning[modelName,line1];
+	BuildEvaluate[modelName,WarsawAll/@keyList,line1];
+	BuildScaleCoefficients[modelName,WarsawAll/@keyList,line1];
+	BuildBatchStruct[modelName,paramList,line1];
+	BuildLoadBatchPoint[modelName,paramList,line1];
+	BuildComputeSharedDual[modelName,itemParts,line1];
+	BuildDerivatives[modelName,paramList,WarsawAll/@keyList,line1];
+	Close[line1];
 	
 	Do[
-		BuildFunctionWarsaw[modelName,WarsawAll[keyList[[k]]],exprList[[k]],ComplexPars(*,YFReplRule*),line1],
-	{k,1,Length[matchingOutput]}];
-	
-	Close[line1];
+		line1 = OpenWrite[path<>"/"<>modelName<>"_part"<>ToString[part]<>".cpp"];
+		BuildPreprocessorDirectives[modelName,line1];
+		BuildComputeSharedPart[modelName,part,itemParts,line1];
+		BuildPruneTablePart[modelName,part,itemParts,bounds,line1];
+		Do[If[wcParts[[k]]==part,
+			BuildFunctionWarsaw[modelName,WarsawAll[keyList[[k]]],exprList[[k]],ComplexPars(*,YFReplRule*),line1]
+		],{k,1,Length[matchingOutput]}];
+		Do[If[wcParts[[k]]==part,
+			BuildFunctionWarsawFill[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],line1]
+		],{k,1,Length[matchingOutput]}];
+		Do[If[wcParts[[k]]==part,
+			BuildFunctionWarsawAll[modelName,WarsawAll[keyList[[k]]],line1]
+		],{k,1,Length[matchingOutput]}];
+		(* batched versions of the WC functions, evaluated over a structure-of-arrays block of parameter points *)
+		Do[If[wcParts[[k]]==part,
+			BuildFunctionWarsawBatch[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],sharedRes[[k,1]],ToString/@paramList[[1]],line1]
+		],{k,1,Length[matchingOutput]}];
+		(* the shared items and the fill methods on Dual numbers, for derivatives *)
+		BuildComputeSharedDualPart[modelName,part,itemParts,params,line1];
+		Do[If[wcParts[[k]]==part,
+			BuildFunctionWarsawFillDual[modelName,WarsawAll[keyList[[k]]],sharedRes[[k,2]],params,line1]
+		],{k,1,Length[matchingOutput]}];
+		Close[line1],
+	{part,1,NumSourceParts}];
 ]
 
 
@@ -0,0 +1,240 @@
+/**
+ * @file AdaptiveScan.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Scan of a generated model class that refines a coarse grid where the requested functions vary
+ *
+ * the coarse grid is split into cells (squares in 2d, cubes in 3d, ...), every cell is evaluated at the midpoints of its edges, faces
+ * and at its center, and halved along every axis on which one of these points deviates from the average of its two neighbours
+ * by more than tolerance times the range of the function on the coarse grid (up to 2^d children, like a quadtree or octree);
+ * the tested points are exactly the corners of the children. Deviations below abs_tolerance, and below 1e-10 of the largest
+ * magnitude of the function on the coarse grid, never split a cell, so that a function that is constant up to rounding is not refined
+ */
+
+#pragma once
+
+#include "ParameterScan.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <cmath>
+
+// every axis has num_points points on the coarse grid, refining max_depth times divides their spacing by 2^max_depth,
+// e.g. {"m1", 0.3, 2.7, 4} with max_depth = 3 reaches the spacing 0.1 of a 25-point grid where needed
+template <class Model>
+class AdaptiveScan {
+    public:
+        std::map<std::string, double> base_params;
+        std::vector<ScanAxis> axes;
+        int max_depth;
+        double tolerance;
+        double abs_tolerance;
+
+        AdaptiveScan() = delete;
+
+        AdaptiveScan(std::map<std::string, double> base_params, std::vector<ScanAxis> axes, int max_depth = 3, double tolerance = 0.01, double abs_tolerance = 0.0)
+            : base_params(base_params), axes(axes), max_depth(max_depth), tolerance(tolerance), abs_tolerance(abs_tolerance) {
+            if (this->axes.empty()) throw std::invalid_argument {"An AdaptiveScan needs at least one axis."};
+            if (max_depth < 0 || max_depth > 20) throw std::invalid_argument {"The depth of an AdaptiveScan has to be between 0 and 20."};
+            for (const ScanAxis& axis : this->axes) {
+                if (axis.num_points < 2) throw std::invalid_argument {"Every axis of an AdaptiveScan needs at least two points, fixed parameters belong to base_params."};
+                axis_params.emplace_back(static_cast<int>(Model::paramIndex(axis.name)));
+            }
+        }
+
+        // refines the grid for funcs and returns their values at the refined points, results[n*funcs.size() + f] holds funcs[f] at point(n),
+        // the points are sorted like the grid of ParameterScan (the last axis runs fastest); num_threads = 0 uses all hardware threads
+        std::vector<double> run(const std::vector<std::function<double(Model&)> >& funcs, unsigned num_threads = 0) {
+            const std::size_t dim = axes.size();
+            const std::size_t num_funcs = funcs.size();
+            const std::int64_t cell = std::int64_t(1) << max_depth;    // lattice units per coarse grid spacing
+
+            lattice.clear();
+            index.clear();
+            results.clear();
+            std::size_t evaluated = 0;
+
+            // coarse grid, the lower corners of its cells are the level 0 cells
+            std::vector<Cell> cells;
+            std::size_t num_coarse = 1;
+            for (const ScanAxis& axis : axes) num_coarse *= axis.num_points;
+            for (std::size_t n = 0; n < num_coarse; n++) {
+                std::vector<std::int64_t> coord(dim);
+                bool lower = true;
+                for (std::size_t a = dim, m = n; a-- > 0; m /= axes[a].num_points) {
+                    const std::int64_t k = m % axes[a].num_points;
+                    coord[a] = k*cell;
+                    lower = lower && k + 1 < axes[a].num_points;
+                }
+                request(coord);
+                if (lower) cells.push_back(Cell(coord, std::vector<std::int64_t>(dim, cell)));
+            }
+            evaluate(funcs, evaluated, num_threads);
+
+            // scale of every function, the deviations are measured against it; the floor keeps rounding noise from splitting cells
+            // when the range is zero or tiny, e.g. for cG, which is constant along m1 up to the last digits
+            std::vector<double> threshold(num_funcs);
+            for (std::size_t f = 0; f < num_funcs; f++) {
+                double lo = results[f], hi = results[f], magnitude = 0.0;
+                for (std::size_t n = 0; n < lattice.size(); n++) {
+                    lo = std::min(lo, results[n*num_funcs + f]);
+                    hi = std::max(hi, results[n*num_funcs + f]);
+                    magnitude = std::max(magnitude, std::abs(results[n*num_funcs + f]));
+                }
+                threshold[f] = std::max({tolerance*(hi - lo), abs_tolerance, 1e-10*magnitude});
+            }
+
+            // the test points of a cell are its 3^d points with local coordinates 0, 1/2 and 1 along every axis that can still be split
+            while (!cells.empty()) {
+                for (const Cell& c : cells) {
+                    for (std::size_t t = 0; t < c.num_tests; t++) request(c.test(t));
+                }
+                evaluate(funcs, evaluated, num_threads);
+
+                std::vector<Cell> refined;
+                for (const Cell& c : cells) {
+                    // the cell is split along an axis when a test point deviates from the average of its two neighbours along that axis,
+                    // so that e.g. a function constant in one parameter is only refined along the others
+                    std::vector<bool> split(dim, false);
+                    for (std::size_t t = 0; t < c.num_tests; t++) {
+                        const std::vector<std::int64_t> coord = c.test(t);
+                        const std::size_t p = index.at(coord);
+                        for (std::size_t a = 0; a < dim; a++) {
+                            if (split[a] || coord[a] == c.lower[a] || coord[a] == c.lower[a] + c.size[a]) continue;
+
+                            std::vector<std::int64_t> lo(coord), hi(coord);
+                            lo[a] -= c.size[a]/2;
+                            hi[a] += c.size[a]/2;
+                            const std::size_t p_lo = index.at(lo), p_hi = index.at(hi);
+                            for (std::size_t f = 0; f < num_funcs && !split[a]; f++) {
+                                const double average = 0.5*(results[p_lo*num_funcs + f] + results[p_hi*num_funcs + f]);
+                                split[a] = std::abs(results[p*num_funcs + f] - average) > threshold[f];
+                            }
+                        }
+                    }
+                    c.split(split, refined);
+                }
+                cells = std::move(refined);
+            }
+
+            sortPoints(num_funcs);
+            return results;
+        }
+
+        // number of points of the last run
+        std::size_t size() const { return lattice.size(); }
+
+        // values of the swept parameters at the n-th point of the last run, in the order of the axes;
+        // the points of the coarse grid take the values of ScanAxis, so the ends of every axis are exactly min and max
+        std::vector<double> point(std::size_t n) const {
+            const std::int64_t cell = std::int64_t(1) << max_depth;
+            std::vector<double> vals(axes.size());
+            for (std::size_t a = 0; a < axes.size(); a++) {
+                const std::int64_t k = lattice[n][a];
+                if (k % cell == 0) vals[a] = axes[a].value(static_cast<int>(k/cell));
+                else vals[a] = axes[a].min + static_cast<double>(k)*(axes[a].max - axes[a].min)/static_cast<double>((axes[a].num_points - 1)*cell);
+            }
+            return vals;
+        }
+
+    private:
+        std::vector<int> axis_params;    // position of every swept parameter in the parameter block of Model
+
+        // points on the lattice of the finest level, every point is evaluated once
+        std::vector<std::vector<std::int64_t> > lattice;
+        std::map<std::vector<std::int64_t>, std::size_t> index;
+        std::vector<double> results;
+
+        // box on the lattice, an axis whose size has reached 1 is not split any further
+        struct Cell {
+            std::vector<std::int64_t> lower;
+            std::vector<std::int64_t> size;
+            std::size_t num_tests = 1;
+
+            Cell(std::vector<std::int64_t> lower, std::vector<std::int64_t> size) : lower(std::move(lower)), size(std::move(size)) {
+                for (std::int64_t s : this->size) num_tests *= (s > 1) ? 3 : 2;
+            }
+
+            // t-th test point, the first axis runs fastest
+            std::vector<std::int64_t> test(std::size_t t) const {
+                std::vector<std::int64_t> coord(lower);
+                for (std::size_t a = 0; a < coord.size(); a++) {
+                    if (size[a] > 1) {
+                        coord[a] += static_cast<std::int64_t>(t % 3)*size[a]/2;
+                        t /= 3;
+                    } else {
+                        coord[a] += static_cast<std::int64_t>(t % 2);
+                        t /= 2;
+                    }
+                }
+                return coord;
+            }
+
+            // appends the children along the axes in split, nothing if split is empty
+            void split(const std::vector<bool>& axes, std::vector<Cell>& children) const {
+                std::vector<std::int64_t> half(size);
+                std::size_t num_children = 1;
+                for (std::size_t a = 0; a < size.size(); a++) {
+                    if (axes[a]) {
+                        half[a] /= 2;
+                        num_children *= 2;
+                    }
+                }
+                if (num_children == 1) return;
+
+                for (std::size_t k = 0; k < num_children; k++) {
+                    std::vector<std::int64_t> child(lower);
+                    for (std::size_t a = 0, m = k; a < size.size(); a++) {
+                        if (!axes[a]) continue;
+                        child[a] += static_cast<std::int64_t>(m % 2)*half[a];
+                        m /= 2;
+                    }
+                    children.emplace_back(std::move(child), half);
+                }
+            }
+        };
+
+        void request(const std::vector<std::int64_t>& coord) {
+            if (index.emplace(coord, lattice.size()).second) lattice.push_back(coord);
+        }
+
+        // evaluates the points from first on with evaluatePoints, every thread works on its own instance of Model
+        void evaluate(const std::vector<std::function<double(Model&)> >& funcs, std::size_t& first, unsigned num_threads) {
+            const std::size_t num_funcs = funcs.size();
+            const std::size_t end = lattice.size();
+            const std::size_t row_size = axes.size() + num_funcs;
+            results.resize(end*num_funcs);
+            if (first == end) return;
+
+            const std::size_t offset = first;
+            evaluatePoints<Model>(base_params, axis_params, end - offset, [this, offset](std::size_t n){ return point(offset + n); }, funcs, num_threads,
+                [&](std::size_t start, std::size_t count, const double* rows) {
+                    for (std::size_t n = 0; n < count; n++) {
+                        const double* row = rows + n*row_size + axes.size();
+                        std::copy(row, row + num_funcs, results.begin() + (offset + start + n)*num_funcs);
+                    }
+                });
+            first = end;
+        }
+
+        void sortPoints(std::size_t num_funcs) {
+            std::vector<std::size_t> order(lattice.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j){ return lattice[i] < lattice[j]; });
+
+            std::vector<std::vector<std::int64_t> > sorted_lattice(lattice.size());
+            std::vector<double> sorted_results(results.size());
+            for (std::size_t n = 0; n < order.size(); n++) {
+                sorted_lattice[n] = std::move(lattice[order[n]]);
+                std::copy(results.begin() + order[n]*num_funcs, results.begin() + (order[n] + 1)*num_funcs, sorted_results.begin() + n*num_funcs);
+                index[sorted_lattice[n]] = n;
+            }
+            lattice = std::move(sorted_lattice);
+            results = std::move(sorted_results);
+        }
+};
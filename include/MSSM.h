@@ -3,10 +3,144 @@
 #include <string>
 #include <map>
 #include <functional>
+#include <array>
+#include "OperatorImport.h"
 #define hbar 0.006332574
 
 
+// parameters of the model, vectors and matrices are split into their components (matrices row-major)
+enum class MSSMParam : int {
+    cgamma, g1, g2, g3, m1, m2, m3, mHsq, mPhi, muTilde,
+    mdt1, mdt2, mdt3,
+    met1, met2, met3,
+    mlt1, mlt2, mlt3,
+    mqt1, mqt2, mqt3,
+    mut1, mut2, mut3,
+    ad11, ad12, ad13, ad21, ad22, ad23, ad31, ad32, ad33,
+    ae11, ae12, ae13, ae21, ae22, ae23, ae31, ae32, ae33,
+    au11, au12, au13, au21, au22, au23, au31, au32, au33,
+    yd11, yd12, yd13, yd21, yd22, yd23, yd31, yd32, yd33,
+    ye11, ye12, ye13, ye21, ye22, ye23, ye31, ye32, ye33,
+    yu11, yu12, yu13, yu21, yu22, yu23, yu31, yu32, yu33,
+    count
+};
+
+// structure-of-arrays block of parameter points for the _batch methods, with one column of length size per parameter
+struct MSSMBatch {
+    std::size_t size = 0;
+
+    std::vector<double> cgamma, g1, g2, g3, m1, m2, m3, mHsq, mPhi, muTilde;
+
+    std::vector<double> mdt1, mdt2, mdt3;
+    std::vector<double> met1, met2, met3;
+    std::vector<double> mlt1, mlt2, mlt3;
+    std::vector<double> mqt1, mqt2, mqt3;
+    std::vector<double> mut1, mut2, mut3;
+
+    std::vector<double> ad11, ad12, ad13, ad21, ad22, ad23, ad31, ad32, ad33;
+    std::vector<double> ae11, ae12, ae13, ae21, ae22, ae23, ae31, ae32, ae33;
+    std::vector<double> au11, au12, au13, au21, au22, au23, au31, au32, au33;
+    std::vector<double> yd11, yd12, yd13, yd21, yd22, yd23, yd31, yd32, yd33;
+    std::vector<double> ye11, ye12, ye13, ye21, ye22, ye23, ye31, ye32, ye33;
+    std::vector<double> yu11, yu12, yu13, yu21, yu22, yu23, yu31, yu32, yu33;
+
+    MSSMBatch() = default;
+
+    // every column is filled with the value from params, or 0.0 if it is absent
+    MSSMBatch(std::size_t n, const std::map<std::string, double>& params = {});
+};
+
+// values of all WCs at one parameter point, flavour components are stored row-major as in the _all methods
+struct MSSMCoefficients {
+    std::array<double, 9> cllHH{};
+    double cG = 0.0;
+    double cW = 0.0;
+    double cGt = 0.0;
+    double cWt = 0.0;
+    double cH = 0.0;
+    double cHBox = 0.0;
+    double cHD = 0.0;
+    double cHG = 0.0;
+    double cHW = 0.0;
+    double cHB = 0.0;
+    double cHWB = 0.0;
+    double cHGt = 0.0;
+    double cHWt = 0.0;
+    double cHBt = 0.0;
+    double cHWtB = 0.0;
+    std::array<double, 9> ceH{};
+    std::array<double, 9> cuH{};
+    std::array<double, 9> cdH{};
+    std::array<double, 9> ceW{};
+    std::array<double, 9> ceB{};
+    std::array<double, 9> cuG{};
+    std::array<double, 9> cuW{};
+    std::array<double, 9> cuB{};
+    std::array<double, 9> cdG{};
+    std::array<double, 9> cdW{};
+    std::array<double, 9> cdB{};
+    std::array<double, 9> cHl1{};
+    std::array<double, 9> cHl3{};
+    std::array<double, 9> cHe{};
+    std::array<double, 9> cHq1{};
+    std::array<double, 9> cHq3{};
+    std::array<double, 9> cHu{};
+    std::array<double, 9> cHd{};
+    std::array<double, 9> cHud{};
+    std::array<double, 81> cll{};
+    std::array<double, 81> cqq1{};
+    std::array<double, 81> cqq3{};
+    std::array<double, 81> clq1{};
+    std::array<double, 81> clq3{};
+    std::array<double, 81> cee{};
+    std::array<double, 81> cuu{};
+    std::array<double, 81> cdd{};
+    std::array<double, 81> ceu{};
+    std::array<double, 81> ced{};
+    std::array<double, 81> cud1{};
+    std::array<double, 81> cud8{};
+    std::array<double, 81> cle{};
+    std::array<double, 81> clu{};
+    std::array<double, 81> cld{};
+    std::array<double, 81> cqe{};
+    std::array<double, 81> cqu1{};
+    std::array<double, 81> cqu8{};
+    std::array<double, 81> cqd1{};
+    std::array<double, 81> cqd8{};
+    std::array<double, 81> cledq{};
+    std::array<double, 81> cquqd1{};
+    std::array<double, 81> cquqd8{};
+    std::array<double, 81> clequ1{};
+    std::array<double, 81> clequ3{};
+    std::array<double, 81> cduq{};
+    std::array<double, 81> cqqu{};
+    std::array<double, 81> cqqq{};
+    std::array<double, 81> cduu{};
+};
+
+// all WCs as a + b*log(mubarsq); every loop function is affine in log(mubarsq), so the split is exact up to rounding. evaluateScales
+// takes it from evaluateAll at mubarsq and 4*mubarsq, b = (c(4*mubarsq) - c(mubarsq))/log(4) and a = c(mubarsq) - b*log(mubarsq):
+// with e the rounding error of evaluateAll (a few eps times the largest term of a WC), b has an absolute error of about 2e/log(4),
+// which is a large relative error for WCs that barely depend on the scale, and a about |log(mubarsq)| times that
+struct MSSMScaleCoefficients {
+    MSSMCoefficients a;
+    MSSMCoefficients b;
+
+    // values of all WCs at the scale mubarsq, with one multiply-add per component
+    MSSMCoefficients at(double mubarsq) const;
+};
+
+// values of WCs together with their first derivatives, gradient[j] holds the derivatives with respect to the j-th parameter
+// passed to derivatives
+struct MSSMDerivatives {
+    MSSMCoefficients value;
+    std::vector<MSSMCoefficients> gradient;
+};
+
 class MSSM {
+    public:
+        static constexpr int num_flavours = 3;    // size of the flavour-indexed parameters
+
     private:
         double cgamma = 0.0;
         double g1 = 0.0;
@@ -19,25 +153,66 @@ class MSSM {
         double mPhi = 0.0;
         double muTilde = 0.0;
 
-        std::vector<double> mdt = {0.0, 0.0, 0.0};
-        std::vector<double> met = {0.0, 0.0, 0.0};
-        std::vector<double> mlt = {0.0, 0.0, 0.0};
-        std::vector<double> mqt = {0.0, 0.0, 0.0};
-        std::vector<double> mut = {0.0, 0.0, 0.0};
+        std::array<double, num_flavours> mdt{};
+        std::array<double, num_flavours> met{};
+        std::array<double, num_flavours> mlt{};
+        std::array<double, num_flavours> mqt{};
+        std::array<double, num_flavours> mut{};
+
+        std::array<std::array<double, num_flavours>, num_flavours> ad{};
+        std::array<std::array<double, num_flavours>, num_flavours> ae{};
+        std::array<std::array<double, num_flavours>, num_flavours> au{};
+        std::array<std::array<double, num_flavours>, num_flavours> yd{};
+        std::array<std::array<double, num_flavours>, num_flavours> ye{};
+        std::array<std::array<double, num_flavours>, num_flavours> yu{};
+
+        std::vector<double> sh_buf;    // workspace for the subexpressions shared between WCs
+
+        // the subexpressions in sh_buf and the WCs in wc_buf are only recomputed when a parameter they depend on changes
+        std::vector<double> sh_params;    // parameters at the last evaluation, in the order of the parameter enum
+        double sh_mubarsq = 0.0;
+        std::vector<char> sh_valid;
+        std::vector<char> wc_valid;
+        MSSMCoefficients wc_buf;
+
+        std::vector<double> sh_batch;    // values of the _batch methods for batch_block points, one row of lanes per value
+
+        std::vector<Dual> sh_dual;    // workspace of derivatives
 
-        std::vector<std::vector<double> > ad = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
-        std::vector<std::vector<double> > ae = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
-        std::vector<std::vector<double> > au = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
-        std::vector<std::vector<double> > yd = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
-        std::vector<std::vector<double> > ye = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
-        std::vector<std::vector<double> > yu = {{0.0, 0.0, 0.0},{0.0, 0.0, 0.0},{0.0, 0.0, 0.0}};
+        // pruned evaluation, see setPruning
+        double prune_tolerance = 0.0;
+        std::vector<double> prune_min;    // smallest and largest |component| of every parameter at the last evaluation, by dependency bit
+        std::vector<double> prune_max;
+        std::vector<char> sh_pruned;    // pruning decision of every shared item, made by decidePruning
+        std::size_t num_pruned = 0;
+        bool prune_frozen = false;    // keeps the decisions when only the scale changes, for evaluateScales
 
     public:
         MSSM() = default;
 
-        MSSM(std::map<std::string, double> params);
+        MSSM(const std::map<std::string, double>& params);
+
+        // names in params that are not parameters of the model are ignored
+        void updateParams(const std::map<std::string, double>& params);
+
+        // typed access to single parameters, without string lookups
+        // the loop-function cache is keyed on the values of the masses and stays valid, it is only cleared by updateParams and setParams and has a fixed size
+        using Param = MSSMParam;
+        static constexpr int num_params = static_cast<int>(MSSMParam::count);
+
+        void setParam(MSSMParam p, double value);
+
+        double getParam(MSSMParam p) const;
+
+        // bulk access to all parameters, values[k] belongs to MSSMParam(k)
+        void setParams(const double* values);
+
+        void getParams(double* values) const;
+
+        // conversion between parameter names and MSSMParam, paramIndex throws std::invalid_argument for unknown names
+        static MSSMParam paramIndex(const std::string& name);
 
-        void updateParams(std::map<std::string, double> params);
+        static const std::string& paramName(MSSMParam p);
 
         void printParamNames();
 
@@ -108,5 +283,393 @@ class MSSM {
         double cqqq(int i1, int i2, int i3, int i4, double mubarsq);
         double cduu(int i1, int i2, int i3, int i4, double mubarsq);
 
+        // components are stored row-major, e.g. out[3*i1 + i2] or out[27*i1 + 9*i2 + 3*i3 + i4]
+        void cllHH_all(double mubarsq, double* out);
+        void ceH_all(double mubarsq, double* out);
+        void cuH_all(double mubarsq, double* out);
+        void cdH_all(double mubarsq, double* out);
+        void ceW_all(double mubarsq, double* out);
+        void ceB_all(double mubarsq, double* out);
+        void cuG_all(double mubarsq, double* out);
+        void cuW_all(double mubarsq, double* out);
+        void cuB_all(double mubarsq, double* out);
+        void cdG_all(double mubarsq, double* out);
+        void cdW_all(double mubarsq, double* out);
+        void cdB_all(double mubarsq, double* out);
+        void cHl1_all(double mubarsq, double* out);
+        void cHl3_all(double mubarsq, double* out);
+        void cHe_all(double mubarsq, double* out);
+        void cHq1_all(double mubarsq, double* out);
+        void cHq3_all(double mubarsq, double* out);
+        void cHu_all(double mubarsq, double* out);
+        void cHd_all(double mubarsq, double* out);
+        void cHud_all(double mubarsq, double* out);
+        void cll_all(double mubarsq, double* out);
+        void cqq1_all(double mubarsq, double* out);
+        void cqq3_all(double mubarsq, double* out);
+        void clq1_all(double mubarsq, double* out);
+        void clq3_all(double mubarsq, double* out);
+        void cee_all(double mubarsq, double* out);
+        void cuu_all(double mubarsq, double* out);
+        void cdd_all(double mubarsq, double* out);
+        void ceu_all(double mubarsq, double* out);
+        void ced_all(double mubarsq, double* out);
+        void cud1_all(double mubarsq, double* out);
+        void cud8_all(double mubarsq, double* out);
+        void cle_all(double mubarsq, double* out);
+        void clu_all(double mubarsq, double* out);
+        void cld_all(double mubarsq, double* out);
+        void cqe_all(double mubarsq, double* out);
+        void cqu1_all(double mubarsq, double* out);
+        void cqu8_all(double mubarsq, double* out);
+        void cqd1_all(double mubarsq, double* out);
+        void cqd8_all(double mubarsq, double* out);
+        void cledq_all(double mubarsq, double* out);
+        void cquqd1_all(double mubarsq, double* out);
+        void cquqd8_all(double mubarsq, double* out);
+        void clequ1_all(double mubarsq, double* out);
+        void clequ3_all(double mubarsq, double* out);
+        void cduq_all(double mubarsq, double* out);
+        void cqqu_all(double mubarsq, double* out);
+        void cqqq_all(double mubarsq, double* out);
+        void cduu_all(double mubarsq, double* out);
+
+        // batched evaluation over a block of points, out[c*points.size + n] is the component c (row-major as in the _all methods)
+        // at point n: the shared items of every point are computed as in the _all methods, then the WC is combined for batch_block
+        // points at a time in loops over the points, which the compiler vectorizes at -O3 (GCC 12 and later already at -O2); the
+        // parameters of the model are restored at the end
+        static constexpr std::size_t batch_block = 16;
+
+        void cllHH_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cG_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cW_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cGt_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cWt_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cH_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHBox_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHD_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHG_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHW_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHWB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHGt_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHWt_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHBt_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHWtB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void ceH_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cuH_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cdH_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void ceW_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void ceB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cuG_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cuW_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cuB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cdG_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cdW_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cdB_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHl1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHl3_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHe_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHq1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHq3_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHu_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHd_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cHud_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cll_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqq1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqq3_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void clq1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void clq3_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cee_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cuu_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cdd_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void ceu_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void ced_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cud1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cud8_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cle_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void clu_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cld_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqe_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqu1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqu8_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqd1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqd8_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cledq_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cquqd1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cquqd8_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void clequ1_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void clequ3_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cduq_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqqu_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cqqq_batch(const MSSMBatch& points, double mubarsq, double* out);
+        void cduu_batch(const MSSMBatch& points, double mubarsq, double* out);
+
+        // evaluation of all (or of a requested subset of) WCs, subexpressions shared between them are computed once
+        MSSMCoefficients evaluateAll(double mubarsq);
+
+        MSSMCoefficients evaluate(double mubarsq, const std::vector<std::string>& wc_names);
+
+        // names of all WCs accepted by evaluate, in the order in which evaluateAll computes them
+        static const std::vector<std::string>& wcNames();
+
+        // split of all WCs into their scale-independent part and the coefficient of log(mubarsq), from evaluateAll at two scales,
+        // see MSSMScaleCoefficients for its precision
+        MSSMScaleCoefficients evaluateScales(double mubarsq);
+
+        // values and first derivatives of the WCs in wc_names with respect to the parameters in directions, by forward-mode
+        // automatic differentiation: the shared items and the WCs are evaluated once on Dual numbers, which carry dual_directions
+        // derivatives, so that every further dual_directions parameters take another pass; the values are the ones of evaluate
+        // without pruning, and the state of the incremental evaluation is left as it is
+        MSSMDerivatives derivatives(double mubarsq, const std::vector<std::string>& wc_names, const std::vector<MSSMParam>& directions);
+
+        // pruned evaluation for decoupled heavy states: evaluateAll, evaluate and the _all methods set shared term groups (an
+        // EinsSum with a loop function) to zero as long as the upper bounds on their contributions add up to less than tolerance in
+        // every WC, so that all pruned groups together change every WC component by less than tolerance; the groups are decided
+        // once per parameter point and scale, and evaluateScales keeps the decisions of mubarsq at 4*mubarsq; tolerance 0 switches
+        // the pruning off
+        void setPruning(double tolerance);
+
+        double pruningTolerance() const;
+
+        // number of term groups set to zero in the current results
+        std::size_t prunedTerms() const;
+
+
+    private:
+        static const int num_shared_items;
+        static const int num_shared_values;
+
+        void computeShared(int k, double mubarsq, double* sh);
+        void computeShared_part1(int k, double mubarsq, double* sh);
+        void computeShared_part2(int k, double mubarsq, double* sh);
+        void computeShared_part3(int k, double mubarsq, double* sh);
+        void computeShared_part4(int k, double mubarsq, double* sh);
+        void computeShared_part5(int k, double mubarsq, double* sh);
+        void computeShared_part6(int k, double mubarsq, double* sh);
+        void computeShared_part7(int k, double mubarsq, double* sh);
+        void computeShared_part8(int k, double mubarsq, double* sh);
+
+        // marks the subexpressions and WCs that depend on the parameters or the scale changed since the last evaluation
+        void invalidate(double mubarsq);
+
+        // bounds on the terms that multiply the shared items of a part, for the pruned evaluation: the terms of the WC wc are at most
+        // coefficient*factors[factor]*prod_b x_b^monomials[monomial][b] times the item without its flavour sum, with the largest
+        // |component| x_b of the parameters of dependency bit b for positive exponents and the smallest one for negative exponents
+        static constexpr int num_dep_bits = 21;
+
+        struct TermBound {
+            int wc;
+            int monomial;
+            int factor;
+            double coefficient;
+        };
+
+        struct PruneTable {
+            int first_item;
+            int end_item;
+            std::vector<int> item_bounds;    // the bounds of item first_item + i are [item_bounds[i], item_bounds[i + 1]) in bounds
+            std::vector<TermBound> bounds;
+            std::vector<std::array<signed char, num_dep_bits> > monomials;
+        };
+
+        static const PruneTable& pruneTable_part1();
+        static const PruneTable& pruneTable_part2();
+        static const PruneTable& pruneTable_part3();
+        static const PruneTable& pruneTable_part4();
+        static const PruneTable& pruneTable_part5();
+        static const PruneTable& pruneTable_part6();
+        static const PruneTable& pruneTable_part7();
+        static const PruneTable& pruneTable_part8();
+
+        // |sums of parameters| in the bounds of a part, by TermBound::factor
+        void pruneFactors_part1(std::vector<double>& factors) const;
+        void pruneFactors_part2(std::vector<double>& factors) const;
+        void pruneFactors_part3(std::vector<double>& factors) const;
+        void pruneFactors_part4(std::vector<double>& factors) const;
+        void pruneFactors_part5(std::vector<double>& factors) const;
+        void pruneFactors_part6(std::vector<double>& factors) const;
+        void pruneFactors_part7(std::vector<double>& factors) const;
+        void pruneFactors_part8(std::vector<double>& factors) const;
+
+        // decides which items are pruned at the parameter values and the scale mubarsq, and marks the items and WCs whose decision changed
+        void decidePruning(const double* values, double mubarsq);
+
+        void prunePart(const PruneTable& table, const std::vector<double>& factors, double mubarsq, std::vector<double>& used);
+
+        // sets the values of the shared item k in sh to zero if it is pruned
+        bool pruneShared(int k, double* sh);
+
+        static const std::map<std::string, std::vector<int> >& sharedItems();
+
+        // loads point n of a batch, computes the shared items and copies their values, in the order of items, into the lane of sh_batch
+        void loadBatchPoint(const MSSMBatch& points, std::size_t n, double mubarsq, const std::vector<int>& items, std::size_t lane);
+
+        void cllHH_fill(double mubarsq, const double* sh, double* out);
+        void cG_fill(double mubarsq, const double* sh, double* out);
+        void cW_fill(double mubarsq, const double* sh, double* out);
+        void cGt_fill(double mubarsq, const double* sh, double* out);
+        void cWt_fill(double mubarsq, const double* sh, double* out);
+        void cH_fill(double mubarsq, const double* sh, double* out);
+        void cHBox_fill(double mubarsq, const double* sh, double* out);
+        void cHD_fill(double mubarsq, const double* sh, double* out);
+        void cHG_fill(double mubarsq, const double* sh, double* out);
+        void cHW_fill(double mubarsq, const double* sh, double* out);
+        void cHB_fill(double mubarsq, const double* sh, double* out);
+        void cHWB_fill(double mubarsq, const double* sh, double* out);
+        void cHGt_fill(double mubarsq, const double* sh, double* out);
+        void cHWt_fill(double mubarsq, const double* sh, double* out);
+        void cHBt_fill(double mubarsq, const double* sh, double* out);
+        void cHWtB_fill(double mubarsq, const double* sh, double* out);
+        void ceH_fill(double mubarsq, const double* sh, double* out);
+        void cuH_fill(double mubarsq, const double* sh, double* out);
+        void cdH_fill(double mubarsq, const double* sh, double* out);
+        void ceW_fill(double mubarsq, const double* sh, double* out);
+        void ceB_fill(double mubarsq, const double* sh, double* out);
+        void cuG_fill(double mubarsq, const double* sh, double* out);
+        void cuW_fill(double mubarsq, const double* sh, double* out);
+        void cuB_fill(double mubarsq, const double* sh, double* out);
+        void cdG_fill(double mubarsq, const double* sh, double* out);
+        void cdW_fill(double mubarsq, const double* sh, double* out);
+        void cdB_fill(double mubarsq, const double* sh, double* out);
+        void cHl1_fill(double mubarsq, const double* sh, double* out);
+        void cHl3_fill(double mubarsq, const double* sh, double* out);
+        void cHe_fill(double mubarsq, const double* sh, double* out);
+        void cHq1_fill(double mubarsq, const double* sh, double* out);
+        void cHq3_fill(double mubarsq, const double* sh, double* out);
+        void cHu_fill(double mubarsq, const double* sh, double* out);
+        void cHd_fill(double mubarsq, const double* sh, double* out);
+        void cHud_fill(double mubarsq, const double* sh, double* out);
+        void cll_fill(double mubarsq, const double* sh, double* out);
+        void cqq1_fill(double mubarsq, const double* sh, double* out);
+        void cqq3_fill(double mubarsq, const double* sh, double* out);
+        void clq1_fill(double mubarsq, const double* sh, double* out);
+        void clq3_fill(double mubarsq, const double* sh, double* out);
+        void cee_fill(double mubarsq, const double* sh, double* out);
+        void cuu_fill(double mubarsq, const double* sh, double* out);
+        void cdd_fill(double mubarsq, const double* sh, double* out);
+        void ceu_fill(double mubarsq, const double* sh, double* out);
+        void ced_fill(double mubarsq, const double* sh, double* out);
+        void cud1_fill(double mubarsq, const double* sh, double* out);
+        void cud8_fill(double mubarsq, const double* sh, double* out);
+        void cle_fill(double mubarsq, const double* sh, double* out);
+        void clu_fill(double mubarsq, const double* sh, double* out);
+        void cld_fill(double mubarsq, const double* sh, double* out);
+        void cqe_fill(double mubarsq, const double* sh, double* out);
+        void cqu1_fill(double mubarsq, const double* sh, double* out);
+        void cqu8_fill(double mubarsq, const double* sh, double* out);
+        void cqd1_fill(double mubarsq, const double* sh, double* out);
+        void cqd8_fill(double mubarsq, const double* sh, double* out);
+        void cledq_fill(double mubarsq, const double* sh, double* out);
+        void cquqd1_fill(double mubarsq, const double* sh, double* out);
+        void cquqd8_fill(double mubarsq, const double* sh, double* out);
+        void clequ1_fill(double mubarsq, const double* sh, double* out);
+        void clequ3_fill(double mubarsq, const double* sh, double* out);
+        void cduq_fill(double mubarsq, const double* sh, double* out);
+        void cqqu_fill(double mubarsq, const double* sh, double* out);
+        void cqqq_fill(double mubarsq, const double* sh, double* out);
+        void cduu_fill(double mubarsq, const double* sh, double* out);
+
+        struct DualParams {
+            Dual cgamma;
+            Dual g1;
+            Dual g2;
+            Dual g3;
+            Dual m1;
+            Dual m2;
+            Dual m3;
+            Dual mHsq;
+            Dual mPhi;
+            Dual muTilde;
+            std::array<Dual, num_flavours> mdt;
+            std::array<Dual, num_flavours> met;
+            std::array<Dual, num_flavours> mlt;
+            std::array<Dual, num_flavours> mqt;
+            std::array<Dual, num_flavours> mut;
+            std::array<std::array<Dual, num_flavours>, num_flavours> ad;
+            std::array<std::array<Dual, num_flavours>, num_flavours> ae;
+            std::array<std::array<Dual, num_flavours>, num_flavours> au;
+            std::array<std::array<Dual, num_flavours>, num_flavours> yd;
+            std::array<std::array<Dual, num_flavours>, num_flavours> ye;
+            std::array<std::array<Dual, num_flavours>, num_flavours> yu;
+        };
+
+        // the parameters with the derivative j in the direction of the parameter directions[first + j]
+        void dualParams(const std::vector<MSSMParam>& directions, std::size_t first, DualParams& p) const;
+
+        void computeSharedDual(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part1(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part2(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part3(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part4(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part5(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part6(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part7(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+        void computeSharedDual_part8(int k, double mubarsq, const DualParams& p, Dual* sh) const;
+
+        void cllHH_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cG_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cW_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cGt_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cWt_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cH_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHBox_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHD_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHG_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHW_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHWB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHGt_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHWt_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHBt_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHWtB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void ceH_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cuH_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cdH_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void ceW_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void ceB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cuG_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cuW_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cuB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cdG_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cdW_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cdB_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHl1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHl3_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHe_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHq1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHq3_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHd_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cHud_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cll_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqq1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqq3_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void clq1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void clq3_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cee_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cuu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cdd_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void ceu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void ced_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cud1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cud8_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cle_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void clu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cld_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqe_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqu1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqu8_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqd1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqd8_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cledq_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cquqd1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cquqd8_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void clequ1_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void clequ3_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cduq_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqqu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cqqq_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
+        void cduu_fillDual(double mubarsq, const DualParams& p, const Dual* sh, Dual* out) const;
 
 };
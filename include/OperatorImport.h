@@ -5,63 +5,483 @@
  * @brief header file correspondig to OperatorImport.cpp
  */
 
+#pragma once
+
 #include <vector>
 #include <variant>
 #include <tuple>
 #include <functional>
+#include <span>
+#include <unordered_map>
+#include <array>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <string>
+
+#ifdef OPERATOR_PROFILE
+#include <chrono>
+#include <ostream>
+#endif
 
 typedef std::tuple<std::function<double(int, int, double)>, double> YF_tuple;
 
+// opt-in instrumentation, compiled in with -DOPERATOR_PROFILE (make PROFILE=1) and to nothing otherwise
+// counts the calls and sums the (inclusive) time per loop-function code, per EinsSum index pattern and per generated WC method,
+// every thread records on its own and the totals are written as csv to stderr when the program ends
+#ifdef OPERATOR_PROFILE
+class ContractionPlan;
+
+class Profiler {
+    public:
+        Profiler() = delete;
+
+        // totals of the threads that have finished and of the calling thread, sorted by time within every kind
+        static void report(std::ostream& out);
+
+        static void reset();
+};
+
+// times the enclosing scope and books it on a loop-function code, a contraction plan or a method name (a string literal)
+class ProfileScope {
+    public:
+        explicit ProfileScope(int lf_code) : kind(0), code(lf_code), key(nullptr), start(std::chrono::steady_clock::now()) {}
+        explicit ProfileScope(const ContractionPlan* plan) : kind(1), code(0), key(plan), start(std::chrono::steady_clock::now()) {}
+        explicit ProfileScope(const char* method) : kind(2), code(0), key(method), start(std::chrono::steady_clock::now()) {}
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        ~ProfileScope();
+
+    private:
+        int kind;
+        int code;
+        const void* key;
+        std::chrono::steady_clock::time_point start;
+};
+
+#define OPERATOR_PROFILE_SCOPE(key) ProfileScope operator_profile_scope(key)
+#else
+#define OPERATOR_PROFILE_SCOPE(key) static_cast<void>(0)
+#endif
+
+// number of flavours of EinsSum and Contraction when none is given, the generated model classes carry their own num_flavours
+inline constexpr int default_num_flavours = 3;
+
+// flavour-indexed mass, refers to the storage of the model (std::array or std::vector) instead of copying it
+typedef std::span<const double> MassVec;
+
+// non-owning view of a square matrix stored as std::array<std::array<double, N>, N>
+class MatrixView {
+    public:
+        const double* data;
+        int num_cols;
+
+        template <std::size_t N>
+        MatrixView(const std::array<std::array<double, N>, N>& matrix) : data(matrix[0].data()), num_cols(N) {}
+};
+
+// the vector-valued masses are referenced, so a LoopFunc must not outlive the masses it is constructed from
 class LoopFunc {
     public:
-        std::vector<std::variant<std::vector<double>, double> > masses;
+        std::vector<std::variant<MassVec, double> > masses;
         int code;
         double mubarsq;
 
         LoopFunc() = delete;
-        LoopFunc(std::vector<std::variant<std::vector<double>, double> > list_of_masses, int code, double mubarsq);
+        LoopFunc(std::vector<std::variant<MassVec, double> > list_of_masses, int code, double mubarsq);
+};
+
+// number of loop-function codes, the codes run from 1 to lf_num_codes
+inline constexpr int lf_num_codes = 132;
+
+// number of masses taken by the loop function with the given code
+constexpr int lfArity(int code) {
+    return code <= 18 ? 1 : code <= 58 ? 2 : code <= 101 ? 3 : code <= 124 ? 4 : code <= 131 ? 5 : 6;
+}
+
+// mass dimension of the loop function with the given code: 4 - 2*(a1 + ... + an) - 2*k for its exponents {a1, ..., an, k}
+// in ReplLoopFuncExpns of OperatorExport.m, the kernels scale as t^d when all masses and sqrt(mubarsq) are scaled by t
+constexpr int lfDimension(int code) {
+    constexpr std::array<int, lf_num_codes + 1> dimensions = {0,
+        2, 0, -2, 2, 0, -2, 0, -2, 0, -2, -4, -2, -4, -6, -2, -4, -6, -8, 2, 0, 0, -2,
+        -2, -4, -4, -6, -8, 0, -2, 0, -2, -4, -2, -4, -6, -6, -8, 0, -2, -4, -2, -4, -6, -2,
+        -4, -6, -8, -2, -4, -6, -2, -4, -6, -8, -2, -4, -6, -8, 0, -2, -2, -4, -4, -6, -8, -2,
+        -4, -4, -6, -8, -4, -6, -8, -8, 0, -2, -4, -2, -4, -6, -8, -2, -4, -6, -6, -8, -6, -8,
+        -2, -4, -6, -6, -8, -2, -4, -6, -8, -2, -4, -6, -8, -2, -4, -4, -6, -8, -4, -6, -8, -8,
+        -4, -6, -8, -8, -8, -2, -4, -6, -8, -8, -6, -8, -6, -8, -4, -6, -8, -8, -8, -8, -8, -8};
+    return dimensions[code];
+}
+
+// constant C of the bound |LF| <= C*logs*s on the loop function with the given code, for masses between light and top, a mass of at
+// least heavy among them and logs = 1 + max(|log(mubarsq/light^2)|, |log(mubarsq/top^2)|) + 2*log(top/light); the size s is top^d
+// for d = lfDimension(code) >= 0 and max(heavy^d, light^(d+2)/heavy^2) for d < 0
+// with A = a1 + ... + an and H_n the harmonic numbers, the integral representation over t = l^2 gives C = 1 + H_(A-1) for d = 0,
+// C = A*(2 + H_A) for d = 2 by integrating the mass derivatives (of dimension 0) from zero masses, C = 1 + log(2) for d = -2 and
+// C = 2/|d| + 1/(|d|/2 - 1) for d <= -4 by splitting the integral at heavy^2, and C = 1 for the single-mass code 3 with k = 2;
+// the values are rounded up
+constexpr double lfBound(int code) {
+    constexpr std::array<double, lf_num_codes + 1> bounds = {0.0,
+        3.0, 1.0, 1.0, 7.0, 2.0, 1.6932, 2.5, 1.6932, 2.8334, 1.6932, 1.5, 1.6932, 1.5, 0.8334, 1.6932, 1.5,
+        0.8334, 0.5834, 7.0, 2.0, 2.5, 1.6932, 1.6932, 1.5, 1.5, 0.8334, 0.5834, 2.5, 1.6932, 2.8334, 1.6932, 1.5,
+        1.6932, 1.5, 0.8334, 0.8334, 0.5834, 2.8334, 1.6932, 1.5, 1.6932, 1.5, 0.8334, 1.6932, 1.5, 0.8334, 0.5834, 1.6932,
+        1.5, 0.8334, 1.6932, 1.5, 0.8334, 0.5834, 1.6932, 1.5, 0.8334, 0.5834, 2.5, 1.6932, 1.6932, 1.5, 1.5, 0.8334,
+        0.5834, 1.6932, 1.5, 1.5, 0.8334, 0.5834, 1.5, 0.8334, 0.5834, 0.5834, 2.8334, 1.6932, 1.5, 1.6932, 1.5, 0.8334,
+        0.5834, 1.6932, 1.5, 0.8334, 0.8334, 0.5834, 0.8334, 0.5834, 1.6932, 1.5, 0.8334, 0.8334, 0.5834, 1.6932, 1.5, 0.8334,
+        0.5834, 1.6932, 1.5, 0.8334, 0.5834, 1.6932, 1.5, 1.5, 0.8334, 0.5834, 1.5, 0.8334, 0.5834, 0.5834, 1.5, 0.8334,
+        0.5834, 0.5834, 0.5834, 1.6932, 1.5, 0.8334, 0.5834, 0.5834, 0.8334, 0.5834, 0.8334, 0.5834, 1.5, 0.8334, 0.5834, 0.5834,
+        0.5834, 0.5834, 0.5834, 0.5834};
+    return bounds[code];
+}
+
+// exponents {a1, ..., an, k} of the loop function with the given code as in ReplLoopFuncExpns of OperatorExport.m, padded with zeros;
+// on equal masses the kernels hand over to the code with the exponents of the equal masses added up
+constexpr std::array<int, 7> lfExponents(int code) {
+    constexpr std::array<std::array<int, 7>, lf_num_codes + 1> exponents = {{{},
+        {1, 0}, {1, 1}, {1, 2}, {2, -1}, {2, 0}, {2, 1}, {3, -1}, {3, 0}, {4, -2}, {4, -1},
+        {4, 0}, {5, -2}, {5, -1}, {5, 0}, {6, -3}, {6, -2}, {6, -1}, {6, 0}, {1, 1, -1}, {1, 1, 0},
+        {1, 2, -1}, {1, 2, 0}, {1, 3, -1}, {1, 3, 0}, {1, 4, -1}, {1, 4, 0}, {1, 5, 0}, {2, 1, -1}, {2, 1, 0}, {2, 2, -2},
+        {2, 2, -1}, {2, 2, 0}, {2, 3, -2}, {2, 3, -1}, {2, 3, 0}, {2, 4, -1}, {2, 4, 0}, {3, 1, -2}, {3, 1, -1}, {3, 1, 0},
+        {3, 2, -2}, {3, 2, -1}, {3, 2, 0}, {3, 3, -3}, {3, 3, -2}, {3, 3, -1}, {3, 3, 0}, {4, 1, -2}, {4, 1, -1}, {4, 1, 0},
+        {4, 2, -3}, {4, 2, -2}, {4, 2, -1}, {4, 2, 0}, {5, 1, -3}, {5, 1, -2}, {5, 1, -1}, {5, 1, 0}, {1, 1, 1, -1}, {1, 1, 1, 0},
+        {1, 1, 2, -1}, {1, 1, 2, 0}, {1, 1, 3, -1}, {1, 1, 3, 0}, {1, 1, 4, 0}, {1, 2, 1, -1}, {1, 2, 1, 0}, {1, 2, 2, -1}, {1, 2, 2, 0}, {1, 2, 3, 0},
+        {1, 3, 1, -1}, {1, 3, 1, 0}, {1, 3, 2, 0}, {1, 4, 1, 0}, {2, 1, 1, -2}, {2, 1, 1, -1}, {2, 1, 1, 0}, {2, 1, 2, -2}, {2, 1, 2, -1}, {2, 1, 2, 0},
+        {2, 1, 3, 0}, {2, 2, 1, -2}, {2, 2, 1, -1}, {2, 2, 1, 0}, {2, 2, 2, -1}, {2, 2, 2, 0}, {2, 3, 1, -1}, {2, 3, 1, 0}, {3, 1, 1, -2}, {3, 1, 1, -1},
+        {3, 1, 1, 0}, {3, 1, 2, -1}, {3, 1, 2, 0}, {3, 2, 1, -3}, {3, 2, 1, -2}, {3, 2, 1, -1}, {3, 2, 1, 0}, {4, 1, 1, -3}, {4, 1, 1, -2}, {4, 1, 1, -1},
+        {4, 1, 1, 0}, {1, 1, 1, 1, -1}, {1, 1, 1, 1, 0}, {1, 1, 1, 2, -1}, {1, 1, 1, 2, 0}, {1, 1, 1, 3, 0}, {1, 1, 2, 1, -1}, {1, 1, 2, 1, 0}, {1, 1, 2, 2, 0}, {1, 1, 3, 1, 0},
+        {1, 2, 1, 1, -1}, {1, 2, 1, 1, 0}, {1, 2, 1, 2, 0}, {1, 2, 2, 1, 0}, {1, 3, 1, 1, 0}, {2, 1, 1, 1, -2}, {2, 1, 1, 1, -1}, {2, 1, 1, 1, 0}, {2, 1, 1, 2, 0}, {2, 1, 2, 1, 0},
+        {2, 2, 1, 1, -1}, {2, 2, 1, 1, 0}, {3, 1, 1, 1, -1}, {3, 1, 1, 1, 0}, {1, 1, 1, 1, 1, -1}, {1, 1, 1, 1, 1, 0}, {1, 1, 1, 1, 2, 0}, {1, 1, 1, 2, 1, 0}, {1, 1, 2, 1, 1, 0}, {1, 2, 1, 1, 1, 0},
+        {2, 1, 1, 1, 1, 0}, {1, 1, 1, 1, 1, 1, 0}
+    }};
+    return exponents[code];
+}
+
+// forward-mode automatic differentiation: a value together with its derivatives in dual_directions directions, which the arithmetic,
+// pow, sqrt and log carry along by the chain rule; comparisons only look at the values
+inline constexpr int dual_directions = 8;
+
+struct Dual {
+    double val = 0.0;
+    std::array<double, dual_directions> der{};
+
+    Dual() = default;
+    Dual(double val) : val(val) {}
+};
+
+Dual operator-(const Dual& a);
+Dual operator+(const Dual& a, const Dual& b);
+Dual operator+(const Dual& a, double b);
+Dual operator+(double a, const Dual& b);
+Dual operator-(const Dual& a, const Dual& b);
+Dual operator-(const Dual& a, double b);
+Dual operator-(double a, const Dual& b);
+Dual operator*(const Dual& a, const Dual& b);
+Dual operator*(const Dual& a, double b);
+Dual operator*(double a, const Dual& b);
+Dual operator/(const Dual& a, const Dual& b);
+Dual operator/(const Dual& a, double b);
+Dual operator/(double a, const Dual& b);
+Dual& operator+=(Dual& a, const Dual& b);
+Dual& operator-=(Dual& a, const Dual& b);
+bool operator==(const Dual& a, const Dual& b);
+Dual pow(const Dual& a, double n);
+Dual sqrt(const Dual& a);
+Dual log(const Dual& a);
+
+// mass argument of the loop functions, with the powers and the logarithm that the kernels use precomputed, for double and Dual masses
+template <class T>
+struct BasicLFMass {
+    T m = 0.0;
+    T sq = 0.0;        // m^2
+    T p4 = 0.0;        // m^4
+    T p6 = 0.0;        // m^6
+    T p8 = 0.0;        // m^8
+    T inv_sq = 0.0;    // m^-2
+    T lg = 0.0;        // log(mubarsq/m^2)
+
+    BasicLFMass() = default;
+    BasicLFMass(const T& m, double mubarsq);
 };
 
-double LF(std::vector<double> masses, int code, double mubarsq);
+typedef BasicLFMass<double> LFMass;
+
+// LFMass of a mass, computed once and then taken from a small per-thread table for as long as the mass and mubarsq stay the same
+const LFMass& lfMass(double m, double mubarsq);
+
+// kernel of a single loop-function code, evaluated on lfArity(code) contiguous masses
+typedef double (*LFKernel)(const LFMass* masses, double mubarsq);
+
+// kernels indexed by code, entry 0 is unused
+extern const std::array<LFKernel, lf_num_codes + 1> lf_kernels;
+
+double LF(std::span<const double> masses, int code, double mubarsq);
+
+double LF(std::initializer_list<double> masses, int code, double mubarsq);
+
+// the derivatives come from the kernels instantiated on Dual; on equal masses, where a kernel hands over to the code that sees only one
+// of them, the derivatives of the equal masses are first replaced by their average weighted with the exponents, which is exact since
+// the derivative of the integral representation with respect to m_i^2 is a_i times that of a single propagator
+Dual LF(std::span<const Dual> masses, int code, double mubarsq);
+
+// the masses have to be prepared with the same mubarsq
+double LF(std::span<const LFMass> masses, int code, double mubarsq);
+
+// loop function with the code bound at compile time, the number of masses is checked against the arity of the code
+template <int Code>
+double LF(const std::array<double, lfArity(Code)>& masses, double mubarsq) {
+    static_assert(Code >= 1 && Code <= lf_num_codes, "unknown loop-function code");
+    OPERATOR_PROFILE_SCOPE(Code);
+    std::array<LFMass, lfArity(Code)> args;
+    for (int i = 0; i < lfArity(Code); i++) args[i] = lfMass(masses[i], mubarsq);
+    return lf_kernels[Code](args.data(), mubarsq);
+}
+
+// per-thread memoization of loop-function values, keyed on (code, masses, mubarsq), in a table of fixed size
+// the generated updateParams methods clear it, so that it mostly holds the values of the current parameter point
+class LFCache {
+    public:
+        static constexpr int max_masses = 6;
+
+        LFCache() = delete;
+
+        static double eval(std::span<const double> masses, int code, double mubarsq);
+
+        static double eval(std::initializer_list<double> masses, int code, double mubarsq);
+
+        static void clear();
+
+        static void enable(bool on);
+
+        static bool enabled();
+
+        // number of values held since the last clear
+        static std::size_t size();
+
+        static unsigned long long hits();
+
+        static unsigned long long misses();
+
+        static double hitRate();
+
+        static void resetStats();
+};
 
 class MassPow {
     public:
-        std::variant<std::vector<double>, double> mass;
+        std::variant<MassVec, double> mass;
         int exp;
 
         MassPow() = delete;
-        MassPow(std::variant<std::vector<double>, double> mass, int exp);
+        MassPow(std::variant<MassVec, double> mass, int exp);
 
 };
 
-double Eval(LoopFunc loopf, const std::vector<int>& idx);
+double Eval(const LoopFunc& loopf, std::span<const int> idx);
 
-double Eval(MassPow masspw, const std::vector<int>& idx);
+double Eval(const MassPow& masspw, std::span<const int> idx);
 
-double Eval(const std::vector<std::vector<double> >& matrix, const std::vector<int>& idx);
+double Eval(const std::vector<std::vector<double> >& matrix, std::span<const int> idx);
 
-double Eval(YF_tuple x, std::vector<int> idx);
+double Eval(const MatrixView& matrix, std::span<const int> idx);
 
-int dim(std::vector<double>& m);
+double Eval(const YF_tuple& x, std::span<const int> idx);
 
-int dim(double& m);
+// counterparts of LoopFunc, MassPow and MatrixView on Dual parameters, for the derivatives of the generated model classes
+typedef std::span<const Dual> DualMassVec;
 
-double apply(std::vector<double>& m, int i);
+class DualMatrixView {
+    public:
+        const Dual* data;
+        int num_cols;
 
-double apply(double& m, int i);
+        template <std::size_t N>
+        DualMatrixView(const std::array<std::array<Dual, N>, N>& matrix) : data(matrix[0].data()), num_cols(N) {}
+};
+
+class DualLoopFunc {
+    public:
+        std::vector<std::variant<DualMassVec, Dual> > masses;
+        int code;
+        double mubarsq;
 
-double exponentiate(std::vector<double> m, const std::vector<int> idx, int pw);
+        DualLoopFunc() = delete;
+        DualLoopFunc(std::vector<std::variant<DualMassVec, Dual> > list_of_masses, int code, double mubarsq);
+};
 
-double exponentiate(double m, const std::vector<int> idx, int pw);
+class DualMassPow {
+    public:
+        std::variant<DualMassVec, Dual> mass;
+        int exp;
 
-int maxRepIdx(const std::vector<std::vector<int> >& v1);
+        DualMassPow() = delete;
+        DualMassPow(std::variant<DualMassVec, Dual> mass, int exp);
+};
 
-std::vector<std::vector<int> > idx_seqs(const std::vector<std::vector<int> >& index_seqs, const std::vector<int>& free_indices, const std::vector<int>& rep_idx_vals);
+Dual Eval(const DualLoopFunc& loopf, std::span<const int> idx);
 
-std::vector<std::vector<int> > idx_seqs(const std::vector<std::vector<int> >& index_seqs, const std::vector<int>& free_indices);
+Dual Eval(const DualMassPow& masspw, std::span<const int> idx);
+
+Dual Eval(const DualMatrixView& matrix, std::span<const int> idx);
+
+int dim(MassVec m);
+
+int dim(const double& m);
+
+double apply(MassVec m, int i);
+
+double apply(const double& m, int i);
+
+double exponentiate(MassVec m, std::span<const int> idx, int pw);
+
+double exponentiate(double m, std::span<const int> idx, int pw);
+
+int maxRepIdx(const std::vector<std::vector<int> >& v1);
 
 std::vector<std::vector<int> > cartesianProduct(int num_flavours, int num_idx);
 
-double EinsSum(std::vector<std::variant<LoopFunc, MassPow, std::vector<std::vector<double> >, YF_tuple> > tensor_objs, std::vector<std::vector<int> > index_order, std::vector<int> free_indices);
+typedef std::variant<LoopFunc, MassPow, std::vector<std::vector<double> >, MatrixView, YF_tuple> TensorObj;
+
+typedef std::variant<DualLoopFunc, DualMassPow, DualMatrixView> DualTensorObj;
+
+// hash over an index_order pattern, so that contraction plans can be looked up without copying the pattern
+struct IndexOrderHash {
+    std::size_t operator()(const std::vector<std::vector<int> >& index_order) const;
+};
+
+// precomputed index tables for one index_order pattern of EinsSum
+class ContractionPlan {
+    public:
+        static constexpr int max_slots = 32;    // upper bound on the total number of indices carried by the tensors of one call
+
+        int num_idx;                    // number of distinct repeated indices
+        int num_combos;                 // number of value combinations of the repeated indices, num_flavours^num_idx
+        int num_slots;                  // total number of index slots across all tensors
+        std::vector<int> tensor_offsets;    // first slot of each tensor, with a trailing entry equal to num_slots
+        std::vector<int> free_slots;        // slots filled (in order) from the free indices
+        std::vector<int> rep_slots;         // slots filled from the repeated indices
+        std::vector<int> rep_table;         // flat (num_combos x rep_slots.size()) table with the values of the repeated indices
+        std::string pattern;                // the index_order pattern as text, e.g. {{12,11},{11,12}}
+
+        ContractionPlan() = delete;
+        ContractionPlan(const std::vector<std::vector<int> >& index_order, int num_flavours);
+
+        double contract(const std::vector<TensorObj>& tensor_objs, const std::vector<int>& free_indices) const;
+
+        Dual contract(const std::vector<DualTensorObj>& tensor_objs, const std::vector<int>& free_indices) const;
+
+        static const ContractionPlan& get(const std::vector<std::vector<int> >& index_order, int num_flavours);
+};
+
+// Einstein summation over NF flavours, the generated model classes call EinsSum<num_flavours>
+template <int NF = default_num_flavours>
+double EinsSum(const std::vector<TensorObj>& tensor_objs, const std::vector<std::vector<int> >& index_order, const std::vector<int>& free_indices) {
+    static_assert(NF > 0, "The number of flavours has to be positive.");
+    return ContractionPlan::get(index_order, NF).contract(tensor_objs, free_indices);
+}
+
+template <int NF = default_num_flavours>
+Dual EinsSum(const std::vector<DualTensorObj>& tensor_objs, const std::vector<std::vector<int> >& index_order, const std::vector<int>& free_indices) {
+    static_assert(NF > 0, "The number of flavours has to be positive.");
+    return ContractionPlan::get(index_order, NF).contract(tensor_objs, free_indices);
+}
+
+// compile-time counterpart of EinsSum, where the tensor types and the index pattern are template parameters
+// Slots<...> lists the indices of one tensor with the same encoding as index_order (1-10 repeated, >10 free), e.g.
+//     Contraction<Slots<12,11>, Slots<11,12> >::eval({i2,i1,i1,i2}, [&](int a, int b){ return LF({m1, mdt[a], mqt[b]}, 77, mubarsq); }, ad)
+// is the same as EinsSum({LoopFunc({m1,mdt,mqt},77,mubarsq),ad},{{12,11},{11,12}},{i2,i1,i1,i2})
+// FlavourContraction<NF, ...> sums over NF flavours, Contraction<...> over default_num_flavours
+template <int... S>
+struct Slots {
+    static constexpr std::array<int, sizeof...(S)> labels{S...};
+};
+
+// value of a tensor for the given indices: callables are called, containers are subscripted, LoopFunc, MassPow and YF_tuple go through Eval
+template <class T, class... I>
+double tensorElement(const T& t, I... i) {
+    if constexpr (std::is_same_v<T, LoopFunc> || std::is_same_v<T, MassPow> || std::is_same_v<T, YF_tuple>) {
+        const std::array<int, sizeof...(I)> idx{i...};
+        return Eval(t, std::span<const int>(idx));
+    } else if constexpr (std::is_invocable_r_v<double, const T&, I...>) {
+        return t(i...);
+    } else if constexpr (sizeof...(I) == 0) {
+        return t;
+    } else {
+        return [&t](int first, auto... rest){ return tensorElement(t[first], rest...); }(i...);
+    }
+}
+
+template <int NF, class... TensorSlots>
+class FlavourContraction {
+    private:
+        static constexpr int num_flavours = NF;
+        static constexpr int num_tensors = sizeof...(TensorSlots);
+        static constexpr std::array<int, num_tensors> num_tensor_slots{(int) TensorSlots::labels.size()...};
+
+        static constexpr int count(bool free) {
+            int n = 0;
+            ((n += [](const auto& labels, bool f){ int k = 0; for (int l : labels) k += (l > 10) == f; return k; }(TensorSlots::labels, free)), ...);
+            return n;
+        }
+
+        static constexpr int maxLabel() {
+            int n = 0;
+            ((n = [](const auto& labels, int m){ for (int l : labels) if (l <= 10 && l > m) m = l; return m; }(TensorSlots::labels, n)), ...);
+            return n;
+        }
+
+        // for every slot (tensor k, position j): the repeated index it carries (0-based), or -(1 + its position in free_indices)
+        static constexpr auto slotSources() {
+            std::array<std::array<int, 32>, num_tensors> src{};
+            int k = 0, f = 0;
+            ([&](const auto& labels){
+                for (std::size_t j = 0; j < labels.size(); j++) src[k][j] = labels[j] > 10 ? -(1 + f++) : labels[j] - 1;
+                k++;
+            }(TensorSlots::labels), ...);
+            return src;
+        }
+
+        static constexpr int ipow(int b, int e) { return e == 0 ? 1 : b*ipow(b, e - 1); }
+
+        static constexpr auto sources = slotSources();
+
+        template <int K, class T, std::size_t... J>
+        static double element(const T& t, const int* rep, const int* free, std::index_sequence<J...>) {
+            return tensorElement(t, (sources[K][J] < 0 ? free[-1 - sources[K][J]] : rep[sources[K][J]])...);
+        }
+
+        template <class... Ts, std::size_t... K>
+        static double product(const int* rep, const int* free, std::index_sequence<K...>, const Ts&... tensors) {
+            double prod = 1.0;
+            ((prod *= element<K>(tensors, rep, free, std::make_index_sequence<num_tensor_slots[K]>{})), ...);
+            return prod;
+        }
+
+    public:
+        static constexpr int num_idx = maxLabel();                      // number of distinct repeated indices
+        static constexpr int num_free = count(true);                    // number of free indices expected by eval
+        static constexpr int num_combos = ipow(num_flavours, num_idx);  // number of value combinations of the repeated indices
+
+        static_assert(NF > 0, "The number of flavours has to be positive.");
+        static_assert(num_idx <= 10, "Repeated indices are labelled 1 to 10.");
+        static_assert(((TensorSlots::labels.size() <= 32) && ...), "Too many indices on a single tensor.");
+
+        template <class... Ts>
+        static double eval(const std::array<int, num_free>& free_indices, const Ts&... tensors) {
+            static_assert(sizeof...(Ts) == num_tensors, "FlavourContraction::eval needs one tensor per Slots<...> parameter.");
+
+            // same summation order as EinsSum: the first repeated index runs slowest
+            std::array<int, num_idx + 1> rep{};
+            double sum{};
+            for (int c = 0; c < num_combos; c++) {
+                for (int j = num_idx - 1, num = c; j >= 0; j--, num /= num_flavours) rep[j] = num % num_flavours;
+                sum += product(rep.data(), free_indices.data(), std::make_index_sequence<num_tensors>{}, tensors...);
+            }
+            return sum;
+        }
+};
+
+template <class... TensorSlots>
+using Contraction = FlavourContraction<default_num_flavours, TensorSlots...>;
 
 int KronDelta(int a, int b);
@@ -0,0 +1,160 @@
+/**
+ * @file ParameterSampler.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Multithreaded Monte Carlo scan of a generated model class with random or Latin-hypercube points
+ *
+ * the points come from the counter-based generator Philox4x32-10: the random numbers of point n are a function of (seed, n) only,
+ * so every thread draws the points it evaluates itself and the results are bitwise the same for any number of threads;
+ * the Latin hypercube permutes the strata of every axis with a keyed Feistel network instead of a stored permutation
+ */
+
+#pragma once
+
+#include "ParameterScan.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <array>
+#include <functional>
+#include <cstdint>
+#include <cmath>
+#include <stdexcept>
+
+// Philox4x32 with 10 rounds (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"), maps (counter, key) to 4 random words
+inline std::array<std::uint32_t, 4> philox4x32(std::array<std::uint32_t, 4> ctr, std::array<std::uint32_t, 2> key) {
+    for (int r = 0; r < 10; r++) {
+        if (r > 0) {
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        const std::uint64_t p0 = std::uint64_t(0xD2511F53u)*ctr[0];
+        const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u)*ctr[2];
+        ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+               static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+    }
+    return ctr;
+}
+
+enum class Sampling { random, latin_hypercube };
+
+enum class SampleScale { linear, log };
+
+// a sampled parameter between min and max, uniform in the parameter or in its logarithm
+struct SampleAxis {
+    std::string name;
+    double min;
+    double max;
+    SampleScale scale = SampleScale::linear;
+
+    // value at the fraction u in [0, 1) of the axis
+    double value(double u) const {
+        return scale == SampleScale::linear ? min + u*(max - min) : std::exp(std::log(min) + u*(std::log(max) - std::log(min)));
+    }
+};
+
+// num_points points in the box of the axes, point(n) and the results of run do not depend on the number of threads
+template <class Model>
+class ParameterSampler {
+    public:
+        std::map<std::string, double> base_params;
+        std::vector<SampleAxis> axes;
+        std::size_t num_points;
+        Sampling sampling;
+        std::uint64_t seed;
+
+        ParameterSampler() = delete;
+
+        ParameterSampler(std::map<std::string, double> base_params, std::vector<SampleAxis> axes, std::size_t num_points,
+                         Sampling sampling = Sampling::random, std::uint64_t seed = 0)
+            : base_params(base_params), axes(axes), num_points(num_points), sampling(sampling), seed(seed) {
+            for (const SampleAxis& axis : this->axes) {
+                if (!(axis.max >= axis.min)) throw std::invalid_argument {"The range of " + axis.name + " in a ParameterSampler is empty."};
+                if (axis.scale == SampleScale::log && !(axis.min > 0.0)) throw std::invalid_argument {"A log-uniform axis of a ParameterSampler needs min > 0."};
+                axis_params.emplace_back(static_cast<int>(Model::paramIndex(axis.name)));
+            }
+        }
+
+        std::size_t size() const { return num_points; }
+
+        // values of the sampled parameters at the n-th point, in the order of the axes
+        std::vector<double> point(std::size_t n) const {
+            std::vector<double> vals(axes.size());
+            for (std::size_t a = 0; a < axes.size(); a += 2) {
+                const std::array<std::uint32_t, 4> r = philox4x32({static_cast<std::uint32_t>(n), static_cast<std::uint32_t>(n >> 32), static_cast<std::uint32_t>(a), 0},
+                                                                  {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)});
+                for (std::size_t k = a; k < std::min(a + 2, axes.size()); k++) {
+                    double u = toUnit(r[2*(k - a)], r[2*(k - a) + 1]);
+                    // one point per stratum of width 1/num_points along every axis, at a random position inside the stratum
+                    if (sampling == Sampling::latin_hypercube) u = (static_cast<double>(stratum(n, k)) + u)/static_cast<double>(num_points);
+                    vals[k] = axes[k].value(u);
+                }
+            }
+            return vals;
+        }
+
+        // evaluates every function at every point, results[n*funcs.size() + f] holds funcs[f] at point n
+        // num_threads = 0 uses all available hardware threads
+        std::vector<double> run(const std::vector<std::function<double(Model&)> >& funcs, unsigned num_threads = 0) const {
+            return run(funcs.size(), [&funcs](Model& model, double* values){
+                for (std::size_t f = 0; f < funcs.size(); f++) values[f] = funcs[f](model);
+            }, num_threads);
+        }
+
+        // the same with all num_values values of a point written by one call of fill(model, values), e.g. from a single evaluate of the model,
+        // results[n*num_values + k] holds value k at point n
+        std::vector<double> run(std::size_t num_values, const std::function<void(Model&, double*)>& fill, unsigned num_threads = 0) const {
+            const std::size_t row_size = axes.size() + num_values;
+            std::vector<double> results(num_points*num_values);
+
+            run(num_values, fill, [&](std::size_t first, std::size_t n, const double* rows){
+                for (std::size_t k = 0; k < n; k++)
+                    std::copy(rows + k*row_size + axes.size(), rows + (k + 1)*row_size, results.begin() + (first + k)*num_values);
+            }, num_threads);
+            return results;
+        }
+
+        // every finished block of points is handed to sink(first_point, num_points, rows) on the worker thread that computed it,
+        // as for ParameterScan, e.g. to stream the results into an AsyncTextWriter
+        void run(const std::vector<std::function<double(Model&)> >& funcs, const std::function<void(std::size_t, std::size_t, const double*)>& sink,
+                 unsigned num_threads = 0) const {
+            evaluatePoints<Model>(base_params, axis_params, num_points, [this](std::size_t n){ return point(n); }, funcs, num_threads, sink);
+        }
+
+        void run(std::size_t num_values, const std::function<void(Model&, double*)>& fill, const std::function<void(std::size_t, std::size_t, const double*)>& sink,
+                 unsigned num_threads = 0) const {
+            evaluatePoints<Model>(base_params, axis_params, num_points, [this](std::size_t n){ return point(n); }, num_values, fill, num_threads, sink);
+        }
+
+    private:
+        std::vector<int> axis_params;    // position of every sampled parameter in the parameter block of Model
+
+        // uniform double in [0, 1) from the upper 53 bits of two words
+        static double toUnit(std::uint32_t hi, std::uint32_t lo) {
+            return static_cast<double>(((std::uint64_t(hi) << 32) | lo) >> 11)*0x1.0p-53;
+        }
+
+        // stratum of the n-th point along axis a, a permutation of 0, ..., num_points - 1 for every axis:
+        // a 4-round Feistel network on the smallest even number of bits covering num_points, cycle-walking until the result is in range
+        std::size_t stratum(std::size_t n, std::size_t a) const {
+            int bits = 2;
+            while (bits < 64 && (std::uint64_t(1) << bits) < num_points) bits += 2;
+            const int half = bits/2;
+            const std::uint64_t mask = (std::uint64_t(1) << half) - 1;
+
+            std::uint64_t x = n;
+            do {
+                std::uint64_t left = x >> half, right = x & mask;
+                for (std::uint32_t r = 0; r < 4; r++) {
+                    const std::array<std::uint32_t, 4> f = philox4x32({static_cast<std::uint32_t>(right), static_cast<std::uint32_t>(right >> 32),
+                                                                       static_cast<std::uint32_t>(a), 1 + r},
+                                                                      {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)});
+                    const std::uint64_t next = left ^ (((std::uint64_t(f[0]) << 32) | f[1]) & mask);
+                    left = right;
+                    right = next;
+                }
+                x = (left << half) | right;
+            } while (x >= num_points);
+            return x;
+        }
+};
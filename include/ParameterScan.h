@@ -0,0 +1,151 @@
+/**
+ * @file ParameterScan.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Multithreaded scan of a generated model class over an N-dimensional grid of parameters
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+// a swept parameter, taking num_points equidistant values from min to max (both included)
+struct ScanAxis {
+    std::string name;
+    double min;
+    double max;
+    int num_points;
+
+    // the last point is max itself rather than min plus the rounded range, so that the ends of the axis can be read back from the points
+    double value(int k) const { return num_points == 1 ? min : k == num_points - 1 ? max : min + k*(max - min)/(num_points - 1); }
+};
+
+// evaluates funcs at the points point(0), ..., point(num_points - 1) on all threads, every thread on its own instance of Model,
+// point(n) returns the values of the parameters at the positions axis_params of the parameter block of Model;
+// every finished block of points is handed to sink(first_point, num_points, rows) on the thread that computed it, in no particular order,
+// a row holds the parameters followed by the num_values values, which fill(model, values) writes at every point, e.g. from one evaluate
+template <class Model, class Point, class Sink>
+void evaluatePoints(const std::map<std::string, double>& base_params, const std::vector<int>& axis_params, std::size_t num_points, Point&& point,
+                    std::size_t num_values, const std::function<void(Model&, double*)>& fill, unsigned num_threads, Sink&& sink) {
+    const std::size_t num_axes = axis_params.size();
+    const std::size_t row_size = num_axes + num_values;
+
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = std::min<std::size_t>(num_threads, std::max<std::size_t>(num_points, 1));
+
+    // points are handed out in small blocks, so that threads that run into expensive regions do not hold up the others
+    const std::size_t block = 16;
+    std::atomic<std::size_t> next{0};
+    std::vector<std::exception_ptr> errors(num_threads);
+
+    auto worker = [&](unsigned t) {
+        try {
+            Model model(base_params);
+            std::vector<double> values(Model::num_params);
+            model.getParams(values.data());
+            std::vector<double> rows(block*row_size);
+
+            for (std::size_t start = next.fetch_add(block); start < num_points; start = next.fetch_add(block)) {
+                const std::size_t end = std::min(start + block, num_points);
+                for (std::size_t n = start; n < end; n++) {
+                    std::vector<double> vals = point(n);
+                    for (std::size_t a = 0; a < num_axes; a++) values[axis_params[a]] = vals[a];
+                    model.setParams(values.data());
+
+                    double* row = rows.data() + (n - start)*row_size;
+                    std::copy(vals.begin(), vals.end(), row);
+                    fill(model, row + num_axes);
+                }
+                sink(start, end - start, rows.data());
+            }
+        } catch (...) {
+            errors[t] = std::current_exception();
+            next = num_points;
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        for (unsigned t = 1; t < num_threads; t++) pool.emplace_back(worker, t);
+        worker(0);
+    }
+
+    for (std::exception_ptr& e : errors) if (e) std::rethrow_exception(e);
+}
+
+// the same with one function per value
+template <class Model, class Point, class Sink>
+void evaluatePoints(const std::map<std::string, double>& base_params, const std::vector<int>& axis_params, std::size_t num_points, Point&& point,
+                    const std::vector<std::function<double(Model&)> >& funcs, unsigned num_threads, Sink&& sink) {
+    evaluatePoints<Model>(base_params, axis_params, num_points, std::forward<Point>(point), funcs.size(), [&funcs](Model& model, double* values){
+        for (std::size_t f = 0; f < funcs.size(); f++) values[f] = funcs[f](model);
+    }, num_threads, std::forward<Sink>(sink));
+}
+
+// grid scan over any number of axes, the last axis runs fastest
+// every thread evaluates its share of the points on its own instance of Model, so the results do not depend on the number of threads
+// Model is a generated model class, the swept parameters are set through its bulk parameter interface
+template <class Model>
+class ParameterScan {
+    public:
+        std::map<std::string, double> base_params;
+        std::vector<ScanAxis> axes;
+
+        ParameterScan() = delete;
+
+        ParameterScan(std::map<std::string, double> base_params, std::vector<ScanAxis> axes) : base_params(base_params), axes(axes) {
+            for (const ScanAxis& axis : this->axes) {
+                if (axis.num_points < 1) throw std::invalid_argument {"Every axis of a ParameterScan needs at least one point."};
+                axis_params.emplace_back(static_cast<int>(Model::paramIndex(axis.name)));
+            }
+        }
+
+        // total number of grid points
+        std::size_t size() const {
+            std::size_t n = 1;
+            for (const ScanAxis& axis : axes) n *= axis.num_points;
+            return n;
+        }
+
+        // values of the swept parameters at the n-th grid point, in the order of the axes
+        std::vector<double> point(std::size_t n) const {
+            std::vector<double> vals(axes.size());
+            for (int a = (int) axes.size() - 1; a >= 0; a--) {
+                vals[a] = axes[a].value(n % axes[a].num_points);
+                n /= axes[a].num_points;
+            }
+            return vals;
+        }
+
+        // evaluates every function at every grid point, results[n*funcs.size() + f] holds funcs[f] at point n
+        // num_threads = 0 uses all available hardware threads
+        std::vector<double> run(const std::vector<std::function<double(Model&)> >& funcs, unsigned num_threads = 0) const {
+            const std::size_t num_funcs = funcs.size();
+            std::vector<double> results(size()*num_funcs);
+
+            run(funcs, [&](std::size_t first, std::size_t n, const double* rows){
+                for (std::size_t k = 0; k < n; k++)
+                    std::copy(rows + k*(axes.size() + num_funcs) + axes.size(), rows + (k + 1)*(axes.size() + num_funcs), results.begin() + (first + k)*num_funcs);
+            }, num_threads);
+            return results;
+        }
+
+        // same evaluation, but every finished block of points is handed to sink(first_point, num_points, rows) on the worker thread that computed it,
+        // a row holds the swept parameters followed by the function values; blocks arrive in no particular order and sink has to be thread-safe
+        void run(const std::vector<std::function<double(Model&)> >& funcs, const std::function<void(std::size_t, std::size_t, const double*)>& sink,
+                 unsigned num_threads = 0) const {
+            evaluatePoints<Model>(base_params, axis_params, size(), [this](std::size_t n){ return point(n); }, funcs, num_threads, sink);
+        }
+
+    private:
+        std::vector<int> axis_params;    // position of every swept parameter in the parameter block of Model
+};
@@ -0,0 +1,203 @@
+/**
+ * @file ResultWriter.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Text output of result rows, formatted with std::to_chars and written on a separate thread
+ *
+ * the threads producing the rows only copy them into a queue and continue, the writer thread formats them into a large buffer
+ * and writes the buffer to the file in one piece; when the queue is full the producers wait (back-pressure)
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <span>
+#include <map>
+#include <utility>
+#include <fstream>
+#include <charconv>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+
+// format of one column, e.g. {std::chars_format::scientific, 5} writes the same digits as std::format("{:.5e}")
+struct TextColumn {
+    std::chars_format format;
+    int precision;
+};
+
+// rows are numbered from 0 in the order of the file, blocks of rows may arrive from several threads in any order and are written in row order
+class AsyncTextWriter {
+    public:
+        AsyncTextWriter() = delete;
+
+        AsyncTextWriter(const std::string& path, std::vector<TextColumn> columns, char separator = ',',
+                        std::ios::openmode mode = std::ios::trunc, std::size_t max_blocks = 16)
+            : columns(std::move(columns)), separator(separator), max_blocks(std::max<std::size_t>(max_blocks, 1)) {
+            if (this->columns.empty()) throw std::invalid_argument {"An AsyncTextWriter needs at least one column."};
+            file.open(path, std::ios::out | mode);
+            if (!file) throw std::runtime_error {"Cannot open " + path + " for writing."};
+            writer = std::thread(&AsyncTextWriter::loop, this);
+        }
+
+        AsyncTextWriter(const AsyncTextWriter&) = delete;
+        AsyncTextWriter& operator=(const AsyncTextWriter&) = delete;
+
+        ~AsyncTextWriter() {
+            if (writer.joinable()) {
+                try { close(); } catch (...) {}
+            }
+        }
+
+        // writes line (without the newline) after every row handed over before it
+        void writeLine(const std::string& line) {
+            std::unique_lock lock(mutex);
+            push(lock, Item{end_row, 0, {}, line});
+        }
+
+        // appends n rows stored row-major after every row handed over so far
+        void writeRows(const double* rows, std::size_t n) {
+            if (n == 0) return;
+            std::unique_lock lock(mutex);
+            push(lock, Item{end_row, n, std::vector<double>(rows, rows + n*columns.size()), {}});
+        }
+
+        void writeRow(std::span<const double> row) {
+            if (row.size() != columns.size()) throw std::invalid_argument {"Wrong number of values in a row of an AsyncTextWriter."};
+            writeRows(row.data(), 1);
+        }
+
+        // rows first_row to first_row + n - 1, thread-safe, e.g. for the sink of ParameterScan::run
+        void writeBlock(std::size_t first_row, const double* rows, std::size_t n) {
+            if (n == 0) return;
+            std::unique_lock lock(mutex);
+            if (first_row < next_row) throw std::invalid_argument {"Rows of an AsyncTextWriter were written twice."};
+            push(lock, Item{first_row, n, std::vector<double>(rows, rows + n*columns.size()), {}});
+        }
+
+        // waits until everything is written, throws if rows are missing or writing failed
+        void close() {
+            if (!writer.joinable()) throw std::logic_error {"An AsyncTextWriter was closed twice."};
+            {
+                std::lock_guard lock(mutex);
+                closing = true;
+            }
+            ready.notify_one();
+            writer.join();
+            file.close();
+
+            if (error) std::rethrow_exception(error);
+            if (!queue.empty()) throw std::runtime_error {"An AsyncTextWriter was closed with missing rows."};
+            if (file.fail()) throw std::runtime_error {"Writing a text file failed."};
+        }
+
+    private:
+        struct Item {
+            std::size_t first_row;
+            std::size_t num_rows;
+            std::vector<double> rows;
+            std::string line;
+        };
+
+        // flush the formatted text to the file at about this size
+        static constexpr std::size_t flush_bytes = 1 << 20;
+
+        std::ofstream file;
+        std::vector<TextColumn> columns;
+        char separator;
+        std::size_t max_blocks;
+        std::thread writer;
+
+        // shared between the producers and the writer thread, guarded by mutex
+        std::mutex mutex;
+        std::condition_variable ready;    // the next item can be written, or closing
+        std::condition_variable space;    // the queue has room again, or the writer failed
+        std::map<std::pair<std::size_t, std::size_t>, Item> queue;    // ordered by (first_row, submission)
+        std::size_t seq = 0;
+        std::size_t next_row = 0;    // first row not yet written
+        std::size_t end_row = 0;     // one past the last row handed over
+        bool closing = false;
+        std::exception_ptr error;
+
+        void push(std::unique_lock<std::mutex>& lock, Item item) {
+            if (closing) throw std::logic_error {"Write to a closed AsyncTextWriter."};
+            // the block the writer waits for is always taken, otherwise a full queue of later blocks could never drain
+            space.wait(lock, [&]{ return error || queue.size() < max_blocks || item.first_row == next_row; });
+            if (error) std::rethrow_exception(error);
+
+            const bool is_next = item.first_row == next_row;
+            end_row = std::max(end_row, item.first_row + item.num_rows);
+            queue.emplace(std::make_pair(item.first_row, seq++), std::move(item));
+            lock.unlock();
+            if (is_next) ready.notify_one();
+        }
+
+        void loop() {
+            std::string buffer;
+            buffer.reserve(flush_bytes + 4096);
+            try {
+                std::unique_lock lock(mutex);
+                while (true) {
+                    const auto is_ready = [&]{ return !queue.empty() && queue.begin()->first.first == next_row; };
+                    if (!is_ready()) {
+                        // nothing to write for now, so the buffer goes to the file before waiting
+                        if (!buffer.empty()) {
+                            lock.unlock();
+                            flush(buffer);
+                            lock.lock();
+                        }
+                        ready.wait(lock, [&]{ return is_ready() || closing; });
+                        if (!is_ready()) break;
+                    }
+
+                    Item item = std::move(queue.begin()->second);
+                    queue.erase(queue.begin());
+                    lock.unlock();
+
+                    format(buffer, item);
+                    if (buffer.size() >= flush_bytes) flush(buffer);
+
+                    lock.lock();
+                    next_row += item.num_rows;
+                    space.notify_all();
+                }
+                lock.unlock();
+                flush(buffer);
+            } catch (...) {
+                std::lock_guard lock(mutex);
+                error = std::current_exception();
+                space.notify_all();
+            }
+        }
+
+        void format(std::string& buffer, const Item& item) const {
+            if (item.num_rows == 0) {
+                buffer += item.line;
+                buffer += '\n';
+                return;
+            }
+
+            char scratch[512];
+            const double* value = item.rows.data();
+            for (std::size_t r = 0; r < item.num_rows; r++) {
+                for (std::size_t c = 0; c < columns.size(); c++, value++) {
+                    if (c > 0) buffer += separator;
+                    const std::to_chars_result res = std::to_chars(scratch, scratch + sizeof(scratch), *value, columns[c].format, columns[c].precision);
+                    if (res.ec != std::errc{}) throw std::runtime_error {"A value does not fit into a column of an AsyncTextWriter."};
+                    buffer.append(scratch, res.ptr);
+                }
+                buffer += '\n';
+            }
+        }
+
+        void flush(std::string& buffer) {
+            file.write(buffer.data(), buffer.size());
+            file.flush();
+            buffer.clear();
+            if (!file) throw std::runtime_error {"Writing a text file failed."};
+        }
+};
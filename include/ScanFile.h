@@ -0,0 +1,243 @@
+/**
+ * @file ScanFile.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Binary columnar files for scan results, with a block-wise writer and a memory-mapped reader
+ *
+ * layout (native byte order, checked through the byte-order mark):
+ *   ScanFileHeader (64 bytes)
+ *   num_params + num_coefficients names, each as a uint32 length followed by the characters
+ *   zero padding up to data_offset (a multiple of 64)
+ *   one column of num_points doubles per parameter, then one per coefficient
+ * the columns can also be read without this header, e.g. with numpy.memmap at data_offset
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <span>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+struct ScanFileHeader {
+    char magic[8];              // "OPSCAN\0\0"
+    std::uint32_t version;
+    std::uint32_t byte_order;   // 0x01020304 as written by the machine that wrote the file
+    std::uint32_t num_params;
+    std::uint32_t num_coefficients;
+    std::uint64_t num_points;
+    std::uint64_t data_offset;  // first byte of the first column
+    char reserved[24];
+};
+
+static_assert(sizeof(ScanFileHeader) == 64, "ScanFileHeader has to stay 64 bytes.");
+
+inline constexpr char scan_file_magic[8] = {'O', 'P', 'S', 'C', 'A', 'N', 0, 0};
+inline constexpr std::uint32_t scan_file_version = 1;
+inline constexpr std::uint32_t scan_file_byte_order = 0x01020304;
+
+// writes the rows of a scan with a known number of points, rows are collected into blocks and every block is written column by column
+class ScanFileWriter {
+    public:
+        ScanFileWriter() = delete;
+
+        ScanFileWriter(const std::string& path, const std::vector<std::string>& param_names, const std::vector<std::string>& coefficient_names,
+                       std::size_t num_points, std::size_t block_rows = 1 << 16)
+            : num_columns(param_names.size() + coefficient_names.size()), num_points(num_points), block_rows(std::max<std::size_t>(block_rows, 1)) {
+            if (num_columns == 0) throw std::invalid_argument {"A scan file needs at least one column."};
+            file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!file) throw std::runtime_error {"Cannot open " + path + " for writing."};
+
+            ScanFileHeader header{};
+            std::memcpy(header.magic, scan_file_magic, sizeof(header.magic));
+            header.version = scan_file_version;
+            header.byte_order = scan_file_byte_order;
+            header.num_params = param_names.size();
+            header.num_coefficients = coefficient_names.size();
+            header.num_points = num_points;
+
+            std::string names;
+            for (const std::vector<std::string>* list : {&param_names, &coefficient_names}) {
+                for (const std::string& name : *list) {
+                    const std::uint32_t length = name.size();
+                    names.append(reinterpret_cast<const char*>(&length), sizeof(length));
+                    names.append(name);
+                }
+            }
+            data_offset = (sizeof(ScanFileHeader) + names.size() + 63)/64*64;
+            header.data_offset = data_offset;
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(names.data(), names.size());
+            names.assign(data_offset - sizeof(ScanFileHeader) - names.size(), '\0');
+            file.write(names.data(), names.size());
+
+            block.reserve(this->block_rows*num_columns);
+        }
+
+        ScanFileWriter(const ScanFileWriter&) = delete;
+        ScanFileWriter& operator=(const ScanFileWriter&) = delete;
+
+        ~ScanFileWriter() {
+            if (file.is_open()) {
+                try { flush(); } catch (...) {}
+            }
+        }
+
+        // appends rows stored row-major, every row holds the parameters followed by the coefficients
+        void writeRows(const double* rows, std::size_t n) {
+            if (rows_written + block.size()/num_columns + n > num_points) throw std::invalid_argument {"More rows than announced to the ScanFileWriter."};
+            while (n > 0) {
+                const std::size_t take = std::min(n, block_rows - block.size()/num_columns);
+                block.insert(block.end(), rows, rows + take*num_columns);
+                rows += take*num_columns;
+                n -= take;
+                if (block.size() == block_rows*num_columns) flush();
+            }
+        }
+
+        void writeRow(std::span<const double> row) {
+            if (row.size() != num_columns) throw std::invalid_argument {"Wrong number of values in a row of a ScanFileWriter."};
+            writeRows(row.data(), 1);
+        }
+
+        // writes the remaining rows, the file is only complete once all num_points rows are written
+        void close() {
+            flush();
+            file.close();
+            if (rows_written != num_points) throw std::runtime_error {"A scan file was closed before all its rows were written."};
+            if (file.fail()) throw std::runtime_error {"Writing a scan file failed."};
+        }
+
+    private:
+        std::ofstream file;
+        std::size_t num_columns;
+        std::size_t num_points;
+        std::size_t block_rows;
+        std::size_t data_offset = 0;
+        std::size_t rows_written = 0;
+        std::vector<double> block;     // rows of the current block, row-major
+        std::vector<double> column;    // one column of the current block
+
+        void flush() {
+            const std::size_t n = block.size()/num_columns;
+            if (n == 0) return;
+
+            column.resize(n);
+            for (std::size_t c = 0; c < num_columns; c++) {
+                for (std::size_t r = 0; r < n; r++) column[r] = block[r*num_columns + c];
+                file.seekp(data_offset + (c*num_points + rows_written)*sizeof(double));
+                file.write(reinterpret_cast<const char*>(column.data()), n*sizeof(double));
+            }
+            if (!file) throw std::runtime_error {"Writing a scan file failed."};
+
+            rows_written += n;
+            block.clear();
+        }
+};
+
+// read-only view of a scan file, the columns point directly into the mapped file
+class ScanFileReader {
+    public:
+        ScanFileReader() = delete;
+
+        explicit ScanFileReader(const std::string& path) {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error {"Cannot open " + path + "."};
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(ScanFileHeader)) {
+                ::close(fd);
+                throw std::runtime_error {path + " is not a scan file."};
+            }
+            mapped_size = st.st_size;
+            mapped = ::mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapped == MAP_FAILED) throw std::runtime_error {"Cannot map " + path + "."};
+
+            try {
+                parse(path);
+            } catch (...) {
+                ::munmap(mapped, mapped_size);
+                throw;
+            }
+        }
+
+        ScanFileReader(const ScanFileReader&) = delete;
+        ScanFileReader& operator=(const ScanFileReader&) = delete;
+
+        ScanFileReader(ScanFileReader&& other) noexcept
+            : mapped(other.mapped), mapped_size(other.mapped_size), header(other.header), param_names(std::move(other.param_names)),
+              coefficient_names(std::move(other.coefficient_names)) {
+            other.mapped = MAP_FAILED;
+        }
+
+        ~ScanFileReader() {
+            if (mapped != MAP_FAILED) ::munmap(mapped, mapped_size);
+        }
+
+        std::size_t size() const { return header.num_points; }
+
+        const std::vector<std::string>& paramNames() const { return param_names; }
+
+        const std::vector<std::string>& coefficientNames() const { return coefficient_names; }
+
+        // columns in the order of the file, the parameters first
+        std::span<const double> column(std::size_t c) const {
+            if (c >= param_names.size() + coefficient_names.size()) throw std::out_of_range {"Column index out of range in a scan file."};
+            const double* data = reinterpret_cast<const double*>(static_cast<const char*>(mapped) + header.data_offset);
+            return std::span<const double>(data + c*header.num_points, header.num_points);
+        }
+
+        // column of a parameter or a coefficient, throws std::invalid_argument for unknown names
+        std::span<const double> column(const std::string& name) const {
+            auto it = std::find(param_names.begin(), param_names.end(), name);
+            if (it != param_names.end()) return column(it - param_names.begin());
+            it = std::find(coefficient_names.begin(), coefficient_names.end(), name);
+            if (it != coefficient_names.end()) return column(param_names.size() + (it - coefficient_names.begin()));
+            throw std::invalid_argument {"Unknown column " + name + " in a scan file."};
+        }
+
+    private:
+        void* mapped = MAP_FAILED;
+        std::size_t mapped_size = 0;
+        ScanFileHeader header{};
+        std::vector<std::string> param_names;
+        std::vector<std::string> coefficient_names;
+
+        void parse(const std::string& path) {
+            const char* bytes = static_cast<const char*>(mapped);
+            std::memcpy(&header, bytes, sizeof(header));
+            if (std::memcmp(header.magic, scan_file_magic, sizeof(header.magic)) != 0) throw std::runtime_error {path + " is not a scan file."};
+            if (header.version != scan_file_version) throw std::runtime_error {path + " has an unsupported scan file version."};
+            if (header.byte_order != scan_file_byte_order) throw std::runtime_error {path + " was written with a different byte order."};
+
+            // the names have to lie between the header and the data, which has to lie within the file
+            if (header.data_offset < sizeof(header) || header.data_offset > mapped_size) throw std::runtime_error {path + " has a corrupt header."};
+
+            const std::uint64_t num_columns = std::uint64_t(header.num_params) + header.num_coefficients;
+            std::size_t pos = sizeof(header);
+            for (std::uint64_t k = 0; k < num_columns; k++) {
+                std::uint32_t length;
+                if (sizeof(length) > header.data_offset - pos) throw std::runtime_error {path + " has a corrupt header."};
+                std::memcpy(&length, bytes + pos, sizeof(length));
+                pos += sizeof(length);
+                if (length > header.data_offset - pos) throw std::runtime_error {path + " has a corrupt header."};
+                (k < header.num_params ? param_names : coefficient_names).emplace_back(bytes + pos, length);
+                pos += length;
+            }
+
+            // num_columns*num_points doubles have to fit behind data_offset, compared by division so that the product cannot overflow
+            const std::uint64_t data_values = (mapped_size - header.data_offset)/sizeof(double);
+            if (header.data_offset % sizeof(double) != 0 || (num_columns != 0 && header.num_points > data_values/num_columns))
+                throw std::runtime_error {path + " is truncated."};
+        }
+};
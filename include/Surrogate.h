@@ -0,0 +1,284 @@
+/**
+ * @file Surrogate.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Tabulated coefficients of a generated model class on a parameter grid, queried by multilinear or cubic interpolation
+ *
+ * the table is computed once with a ParameterScan and stored as a scan file (see ScanFile.h), every query returns the interpolated value
+ * together with a local error estimate, the difference between the multilinear and the cubic interpolation; optionally every
+ * check_every-th query is also evaluated exactly on the model, which records the actual errors per coefficient
+ */
+
+#pragma once
+
+#include "ParameterScan.h"
+#include "ScanFile.h"
+#include <vector>
+#include <string>
+#include <span>
+#include <array>
+#include <map>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+enum class Interpolation { linear, cubic };
+
+struct SurrogateValue {
+    double value;
+    double error;    // |cubic - multilinear| at the queried point
+};
+
+// actual errors |value - exact| found by the exact re-evaluations of one coefficient
+struct SurrogateCheck {
+    std::size_t count = 0;
+    std::size_t exceeded = 0;    // checks in which the actual error was larger than the reported estimate
+    double max_error = 0.0;
+    double sum_sq = 0.0;
+
+    double rms() const { return count == 0 ? 0.0 : std::sqrt(sum_sq/count); }
+};
+
+// queries are thread-safe, the exact re-evaluations are serialised on one instance of Model
+template <class Model>
+class Surrogate {
+    public:
+        // the largest number of axes, the cubic interpolation of a query touches 4^max_axes grid points
+        static constexpr std::size_t max_axes = 8;
+
+        Interpolation interpolation;
+        std::size_t check_every = 0;    // 0 disables the exact re-evaluations
+
+        Surrogate() = delete;
+
+        // tabulates funcs on the grid of scan, the axes need at least two points each
+        Surrogate(const ParameterScan<Model>& scan, std::vector<std::string> names, const std::vector<std::function<double(Model&)> >& funcs,
+                  Interpolation interpolation = Interpolation::cubic, unsigned num_threads = 0)
+            : interpolation(interpolation), base_params(scan.base_params), axes(scan.axes), names(std::move(names)), funcs(funcs) {
+            if (this->names.size() != funcs.size()) throw std::invalid_argument {"A Surrogate needs one name per function."};
+            init();
+
+            const std::vector<double> res = scan.run(funcs, num_threads);
+            table.resize(res.size());
+            for (std::size_t n = 0; n < num_points; n++) {
+                for (std::size_t c = 0; c < funcs.size(); c++) table[c*num_points + n] = res[n*funcs.size() + c];
+            }
+        }
+
+        // loads a table written by save, base_params are used for the exact re-evaluations after setFunctions
+        Surrogate(const std::string& path, std::map<std::string, double> base_params, Interpolation interpolation = Interpolation::cubic)
+            : interpolation(interpolation), base_params(std::move(base_params)) {
+            const ScanFileReader file(path);
+            names = file.coefficientNames();
+
+            // the grid is recovered from the parameter columns, which have to hold exactly the points of a ParameterScan
+            for (const std::string& name : file.paramNames()) {
+                std::vector<double> vals(file.column(name).begin(), file.column(name).end());
+                std::sort(vals.begin(), vals.end());
+                vals.erase(std::unique(vals.begin(), vals.end()), vals.end());
+                if (vals.empty()) throw std::runtime_error {path + " holds no points."};
+                axes.push_back({name, vals.front(), vals.back(), static_cast<int>(vals.size())});
+            }
+            init();
+
+            // the points inside the axes are compared within a few ulps of the larger end of the axis, since a file may have been written
+            // with the max rounded by an earlier ScanAxis::value
+            if (file.size() != num_points) throw std::runtime_error {path + " does not hold a grid."};
+            const ParameterScan<Model> scan(this->base_params, axes);
+            for (std::size_t n = 0; n < num_points; n++) {
+                const std::vector<double> pt = scan.point(n);
+                for (std::size_t a = 0; a < axes.size(); a++) {
+                    const double ulp = std::numeric_limits<double>::epsilon()*std::max(std::abs(axes[a].min), std::abs(axes[a].max));
+                    if (std::abs(file.column(a)[n] - pt[a]) > 16.0*ulp) throw std::runtime_error {path + " does not hold a grid."};
+                }
+            }
+
+            table.resize(names.size()*num_points);
+            for (std::size_t c = 0; c < names.size(); c++) {
+                const std::span<const double> col = file.column(axes.size() + c);
+                std::copy(col.begin(), col.end(), table.begin() + c*num_points);
+            }
+        }
+
+        // writes the grid and the table as a scan file
+        void save(const std::string& path) const {
+            std::vector<std::string> param_names;
+            for (const ScanAxis& axis : axes) param_names.push_back(axis.name);
+            ScanFileWriter file(path, param_names, names, num_points);
+
+            const ParameterScan<Model> scan(base_params, axes);
+            std::vector<double> row(axes.size() + names.size());
+            for (std::size_t n = 0; n < num_points; n++) {
+                const std::vector<double> pt = scan.point(n);
+                std::copy(pt.begin(), pt.end(), row.begin());
+                for (std::size_t c = 0; c < names.size(); c++) row[axes.size() + c] = table[c*num_points + n];
+                file.writeRow(row);
+            }
+            file.close();
+        }
+
+        // exact functions for the re-evaluations of a loaded table, in the order of coefficientNames
+        void setFunctions(const std::vector<std::function<double(Model&)> >& funcs) {
+            if (funcs.size() != names.size()) throw std::invalid_argument {"A Surrogate needs one function per coefficient."};
+            std::lock_guard lock(check_mutex);
+            this->funcs = funcs;
+        }
+
+        const std::vector<ScanAxis>& gridAxes() const { return axes; }
+
+        const std::vector<std::string>& coefficientNames() const { return names; }
+
+        std::size_t coefficientIndex(const std::string& name) const {
+            auto it = std::find(names.begin(), names.end(), name);
+            if (it == names.end()) throw std::invalid_argument {"Unknown coefficient " + name + " in a Surrogate."};
+            return it - names.begin();
+        }
+
+        // x holds the swept parameters in the order of the axes, throws std::out_of_range outside the grid
+        SurrogateValue operator()(std::span<const double> x, std::size_t c) {
+            if (x.size() != axes.size()) throw std::invalid_argument {"Wrong number of parameters in a query of a Surrogate."};
+            if (c >= names.size()) throw std::out_of_range {"Coefficient index out of range in a Surrogate."};
+
+            const double* values = table.data() + c*num_points;
+            std::array<Stencil<2>, max_axes> linear;
+            std::array<Stencil<4>, max_axes> cubic;
+            for (std::size_t a = 0; a < axes.size(); a++) stencils(a, x[a], linear[a], cubic[a]);
+
+            const double lin = contract(values, linear.data());
+            const double cub = contract(values, cubic.data());
+            SurrogateValue res{interpolation == Interpolation::linear ? lin : cub, std::abs(cub - lin)};
+
+            if (check_every > 0 && queries[c].fetch_add(1, std::memory_order_relaxed) % check_every == 0) check(x, c, res);
+            return res;
+        }
+
+        SurrogateValue operator()(std::span<const double> x, const std::string& name) { return (*this)(x, coefficientIndex(name)); }
+
+        SurrogateCheck checks(std::size_t c) const {
+            std::lock_guard lock(check_mutex);
+            return check_stats.at(c);
+        }
+
+    private:
+        // grid points along one axis (as offsets into the table) and their weights
+        template <std::size_t K>
+        struct Stencil {
+            std::array<std::size_t, K> index;
+            std::array<double, K> weight;
+        };
+
+        std::map<std::string, double> base_params;
+        std::vector<ScanAxis> axes;
+        std::vector<std::string> names;
+        std::vector<std::function<double(Model&)> > funcs;
+        std::vector<std::size_t> strides;    // the last axis runs fastest, as in ParameterScan
+        std::vector<double> scales;          // grid spacings per unit of every axis
+        std::size_t num_points = 0;
+        std::vector<double> table;    // table[c*num_points + n] holds coefficient c at grid point n
+
+        std::unique_ptr<std::atomic<std::size_t>[]> queries;    // per coefficient
+        mutable std::mutex check_mutex;
+        std::unique_ptr<Model> model;
+        std::vector<int> axis_params;
+        std::vector<SurrogateCheck> check_stats;
+
+        void init() {
+            if (axes.empty() || axes.size() > max_axes) throw std::invalid_argument {"A Surrogate needs between 1 and 8 axes."};
+            strides.assign(axes.size(), 1);
+            scales.assign(axes.size(), 0.0);
+            num_points = 1;
+            for (std::size_t a = axes.size(); a-- > 0; ) {
+                if (axes[a].num_points < 2 || !(axes[a].max > axes[a].min)) throw std::invalid_argument {"Every axis of a Surrogate needs at least two distinct points."};
+                strides[a] = num_points;
+                scales[a] = (axes[a].num_points - 1)/(axes[a].max - axes[a].min);
+                num_points *= axes[a].num_points;
+                axis_params.push_back(static_cast<int>(Model::paramIndex(axes[a].name)));
+            }
+            std::reverse(axis_params.begin(), axis_params.end());
+            queries = std::make_unique<std::atomic<std::size_t>[]>(names.size());
+            check_stats.assign(names.size(), SurrogateCheck{});
+        }
+
+        void stencils(std::size_t a, double x, Stencil<2>& linear, Stencil<4>& cubic) const {
+            const int n = axes[a].num_points;
+            if (!(x >= axes[a].min && x <= axes[a].max)) throw std::out_of_range {"Query outside the grid of a Surrogate along " + axes[a].name + "."};
+            const double u = std::min((x - axes[a].min)*scales[a], n - 1.0);
+
+            const int i = std::min(static_cast<int>(u), n - 2);
+            const double t = u - i;
+            const std::size_t stride = strides[a];
+
+            linear.index = {i*stride, (i + 1)*stride};
+            linear.weight = {1.0 - t, t};
+
+            // Catmull-Rom weights on i - 1, ..., i + 2, the ghost points f(-1) = 2 f(0) - f(1) and f(n) = 2 f(n - 1) - f(n - 2)
+            // continue the grid linearly and are folded into the points inside, leaving a zero weight in their place
+            const double t2 = t*t, t3 = t2*t;
+            std::array<double, 4> w = {
+                0.5*(-t3 + 2.0*t2 - t),
+                0.5*(3.0*t3 - 5.0*t2 + 2.0),
+                0.5*(-3.0*t3 + 4.0*t2 + t),
+                0.5*(t3 - t2)
+            };
+            if (i == 0) {
+                w[1] += 2.0*w[0];
+                w[2] -= w[0];
+                w[0] = 0.0;
+            }
+            if (i == n - 2) {
+                w[2] += 2.0*w[3];
+                w[1] -= w[3];
+                w[3] = 0.0;
+            }
+            cubic.index = {(i == 0 ? i : i - 1)*stride, i*stride, (i + 1)*stride, (i == n - 2 ? i + 1 : i + 2)*stride};
+            cubic.weight = w;
+        }
+
+        // tensor product of the stencils of D axes, unrolled for every number of axes
+        template <std::size_t K, std::size_t D>
+        static double contract(const double* values, const Stencil<K>* s) {
+            double res = 0.0;
+            for (std::size_t k = 0; k < K; k++) {
+                if constexpr (D == 1) res += s->weight[k]*values[s->index[k]];
+                else res += s->weight[k]*contract<K, D - 1>(values + s->index[k], s + 1);
+            }
+            return res;
+        }
+
+        template <std::size_t K>
+        double contract(const double* values, const Stencil<K>* s) const {
+            switch (axes.size()) {
+                case 1: return contract<K, 1>(values, s);
+                case 2: return contract<K, 2>(values, s);
+                case 3: return contract<K, 3>(values, s);
+                case 4: return contract<K, 4>(values, s);
+                case 5: return contract<K, 5>(values, s);
+                case 6: return contract<K, 6>(values, s);
+                case 7: return contract<K, 7>(values, s);
+                default: return contract<K, 8>(values, s);
+            }
+        }
+
+        void check(std::span<const double> x, std::size_t c, const SurrogateValue& res) {
+            std::lock_guard lock(check_mutex);
+            if (funcs.empty()) return;
+            if (!model) model = std::make_unique<Model>(base_params);
+
+            std::vector<double> values(Model::num_params);
+            model->getParams(values.data());
+            for (std::size_t a = 0; a < axes.size(); a++) values[axis_params[a]] = x[a];
+            model->setParams(values.data());
+
+            const double error = std::abs(funcs[c](*model) - res.value);
+            SurrogateCheck& stats = check_stats[c];
+            stats.count++;
+            stats.exceeded += error > res.error;
+            stats.max_error = std::max(stats.max_error, error);
+            stats.sum_sq += error*error;
+        }
+};
@@ -0,0 +1,402 @@
+/**
+ * @file TemperedMCMC.h
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Parallel-tempered Metropolis sampling of model parameters against Gaussian constraints on WCs
+ *
+ * every replica runs one chain per temperature, the chains make random-walk Metropolis steps in the unit cube of the axes
+ * (flat priors in the parameters or in their logarithms) and neighbouring temperatures of a replica exchange their states after every step;
+ * the chains are spread over the threads and every chain keeps its own instance of Model, so that its caches follow the small steps
+ * of that chain; all random numbers come from Philox4x32-10 keyed on (seed, chain, step), so runs, and runs resumed from a checkpoint,
+ * are bitwise the same for any number of threads. Points where a constrained WC is not finite have zero likelihood: proposals there
+ * are rejected, and a chain that starts there draws a new initial point
+ */
+
+#pragma once
+
+#include "ParameterSampler.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <array>
+#include <memory>
+#include <functional>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <barrier>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <numbers>
+
+// measurement of a WC, contributing -((func - mean)/sigma)^2/2 to the log-likelihood, func is not used if TemperedMCMC::fill is set
+template <class Model>
+struct GaussianConstraint {
+    std::string name;
+    std::function<double(Model&)> func;
+    double mean;
+    double sigma;
+};
+
+template <class Model>
+class TemperedMCMC {
+    public:
+        std::map<std::string, double> base_params;
+        std::vector<SampleAxis> axes;
+        std::vector<GaussianConstraint<Model> > constraints;
+        std::vector<double> temperatures;    // temperatures[0] = 1 samples the posterior
+        std::size_t num_replicas;
+        std::uint64_t seed;
+
+        std::size_t burn_in = 0;           // steps without output, in which the step sizes are adapted to an acceptance of 1/4
+        std::size_t adapt_every = 50;
+        double initial_step = 0.05;        // width of the proposals in the unit cube of the axes
+
+        std::string checkpoint_path;       // written every checkpoint_every steps and at the end of run, if not empty
+        std::size_t checkpoint_every = 0;
+
+        // if set, fill(model, values) writes the values of all constraints at once, e.g. from one evaluate of the model
+        std::function<void(Model&, double*)> fill;
+
+        TemperedMCMC() = delete;
+
+        // num_temperatures temperatures from 1 to max_temperature in geometric steps
+        TemperedMCMC(std::map<std::string, double> base_params, std::vector<SampleAxis> axes, std::vector<GaussianConstraint<Model> > constraints,
+                     std::size_t num_temperatures = 4, double max_temperature = 10.0, std::size_t num_replicas = 4, std::uint64_t seed = 0)
+            : base_params(base_params), axes(axes), constraints(constraints), num_replicas(num_replicas), seed(seed) {
+            if (this->axes.empty()) throw std::invalid_argument {"A TemperedMCMC needs at least one axis."};
+            if (num_temperatures == 0 || num_replicas == 0) throw std::invalid_argument {"A TemperedMCMC needs at least one temperature and one replica."};
+            if (!(max_temperature >= 1.0)) throw std::invalid_argument {"The temperatures of a TemperedMCMC have to be at least 1."};
+            for (const SampleAxis& axis : this->axes) {
+                if (axis.scale == SampleScale::log && !(axis.min > 0.0)) throw std::invalid_argument {"A log-uniform axis of a TemperedMCMC needs min > 0."};
+                axis_params.emplace_back(static_cast<int>(Model::paramIndex(axis.name)));
+            }
+            for (const GaussianConstraint<Model>& c : this->constraints) {
+                if (!(c.sigma > 0.0)) throw std::invalid_argument {"The constraint on " + c.name + " needs sigma > 0."};
+            }
+            for (std::size_t k = 0; k < num_temperatures; k++)
+                temperatures.push_back(num_temperatures == 1 ? 1.0 : std::pow(max_temperature, static_cast<double>(k)/(num_temperatures - 1)));
+            chains.resize(num_replicas*num_temperatures);
+            swaps_proposed.assign(num_temperatures, 0);
+            swaps_accepted.assign(num_temperatures, 0);
+        }
+
+        // number of steps made so far, including those of the run a checkpoint was written in
+        std::size_t steps() const { return step_count; }
+
+        std::size_t numChains() const { return chains.size(); }
+
+        // chain of the given temperature index in the given replica
+        std::size_t chainIndex(std::size_t replica, std::size_t temperature) const { return replica*temperatures.size() + temperature; }
+
+        double acceptanceRate(std::size_t chain) const {
+            const Chain& c = chains.at(chain);
+            return c.proposed == 0 ? 0.0 : static_cast<double>(c.accepted)/c.proposed;
+        }
+
+        // acceptance of the exchanges between the temperatures k and k + 1
+        double swapRate(std::size_t k) const {
+            return swaps_proposed.at(k) == 0 ? 0.0 : static_cast<double>(swaps_accepted.at(k))/swaps_proposed.at(k);
+        }
+
+        // makes num_steps further steps; after the burn-in, the state of the temperature 1 chain of every replica is handed to
+        // sink(step, replica, row) after every step, in the order of the replicas, with row holding the parameters, the log-likelihood
+        // and the constrained WCs; sink is called from one thread at a time
+        void run(std::size_t num_steps, const std::function<void(std::size_t, std::size_t, const double*)>& sink, unsigned num_threads = 0) {
+            if (num_steps == 0) return;
+            const std::size_t target = step_count + num_steps;
+
+            if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+            num_threads = std::min<std::size_t>(num_threads, chains.size());
+
+            std::vector<std::unique_ptr<Model> > models(chains.size());
+            std::vector<std::exception_ptr> errors(num_threads);
+            std::exception_ptr error;
+            bool stop = false;
+
+            // runs on one thread once all chains have made the step (or have been initialised)
+            auto completion = [&]() noexcept {
+                try {
+                    for (std::exception_ptr& e : errors) if (e && !error) error = e;
+                    if (!error) {
+                        if (!initialized) initialized = true;
+                        else finishStep(sink);
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                stop = error || step_count == target;
+            };
+            std::barrier sync(static_cast<std::ptrdiff_t>(num_threads), completion);
+
+            // chain c is always advanced by thread c % num_threads, on its own instance of Model
+            auto worker = [&](unsigned t) {
+                while (true) {
+                    try {
+                        for (std::size_t c = t; c < chains.size(); c += num_threads) {
+                            if (!models[c]) models[c] = std::make_unique<Model>(base_params);
+                            advance(c, *models[c]);
+                        }
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                    sync.arrive_and_wait();
+                    if (stop) return;
+                }
+            };
+
+            {
+                std::vector<std::jthread> pool;
+                for (unsigned t = 1; t < num_threads; t++) pool.emplace_back(worker, t);
+                worker(0);
+            }
+
+            if (error) std::rethrow_exception(error);
+            if (!checkpoint_path.empty()) saveCheckpoint(checkpoint_path);
+        }
+
+        // the complete state of the sampler, in native byte order; the file is replaced atomically
+        void saveCheckpoint(const std::string& path) const {
+            const std::string tmp = path + ".tmp";
+            {
+                std::ofstream file(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!file) throw std::runtime_error {"Cannot open " + tmp + " for writing."};
+
+                CheckpointHeader header{};
+                std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+                header.version = 1;
+                header.num_axes = axes.size();
+                header.num_constraints = constraints.size();
+                header.num_temperatures = temperatures.size();
+                header.num_replicas = num_replicas;
+                header.seed = seed;
+                header.step = step_count;
+                header.initialized = initialized;
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+                for (const Chain& c : chains) {
+                    write(file, c.u);
+                    write(file, c.values);
+                    const std::array<double, 2> reals = {c.log_likelihood, c.step};
+                    const std::array<std::uint64_t, 4> counts = {c.proposed, c.accepted, c.window_proposed, c.window_accepted};
+                    file.write(reinterpret_cast<const char*>(reals.data()), sizeof(reals));
+                    file.write(reinterpret_cast<const char*>(counts.data()), sizeof(counts));
+                }
+                write(file, swaps_proposed);
+                write(file, swaps_accepted);
+                if (!file) throw std::runtime_error {"Writing the checkpoint " + tmp + " failed."};
+            }
+            std::filesystem::rename(tmp, path);
+        }
+
+        // continues from a checkpoint of a sampler with the same axes, constraints, temperatures, replicas and seed
+        void loadCheckpoint(const std::string& path) {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            if (!file) throw std::runtime_error {"Cannot open " + path + "."};
+
+            CheckpointHeader header{};
+            file.read(reinterpret_cast<char*>(&header), sizeof(header));
+            if (!file || std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0 || header.version != 1)
+                throw std::runtime_error {path + " is not a checkpoint of a TemperedMCMC."};
+            if (header.num_axes != axes.size() || header.num_constraints != constraints.size() || header.num_temperatures != temperatures.size()
+                || header.num_replicas != num_replicas || header.seed != seed)
+                throw std::runtime_error {path + " belongs to a differently configured TemperedMCMC."};
+
+            step_count = header.step;
+            initialized = header.initialized;
+            for (Chain& c : chains) {
+                c.u.resize(axes.size());
+                c.values.resize(constraints.size());
+                read(file, c.u);
+                read(file, c.values);
+                std::array<double, 2> reals;
+                std::array<std::uint64_t, 4> counts;
+                file.read(reinterpret_cast<char*>(reals.data()), sizeof(reals));
+                file.read(reinterpret_cast<char*>(counts.data()), sizeof(counts));
+                c.log_likelihood = reals[0];
+                c.step = reals[1];
+                c.proposed = counts[0];
+                c.accepted = counts[1];
+                c.window_proposed = counts[2];
+                c.window_accepted = counts[3];
+            }
+            read(file, swaps_proposed);
+            read(file, swaps_accepted);
+            if (!file) throw std::runtime_error {path + " is truncated."};
+        }
+
+    private:
+        struct Chain {
+            std::vector<double> u;         // position in the unit cube of the axes
+            std::vector<double> values;    // constrained WCs at u
+            double log_likelihood = 0.0;
+            double step = 0.0;             // width of the proposals, 0 until the chain is initialised
+            std::uint64_t proposed = 0;
+            std::uint64_t accepted = 0;
+            std::uint64_t window_proposed = 0;    // since the last adaptation of step
+            std::uint64_t window_accepted = 0;
+        };
+
+        struct CheckpointHeader {
+            char magic[8];    // "OPMCMC\0\0"
+            std::uint32_t version;
+            std::uint32_t initialized;
+            std::uint64_t num_axes;
+            std::uint64_t num_constraints;
+            std::uint64_t num_temperatures;
+            std::uint64_t num_replicas;
+            std::uint64_t seed;
+            std::uint64_t step;
+        };
+
+        static constexpr char checkpoint_magic[8] = {'O', 'P', 'M', 'C', 'M', 'C', 0, 0};
+        static constexpr std::size_t max_initial_draws = 1000;
+
+        // purposes of the random numbers, the fourth counter word
+        enum : std::uint32_t { rng_init = 0, rng_proposal = 1, rng_accept = 2, rng_swap = 3 };
+
+        std::vector<int> axis_params;    // position of every parameter in the parameter block of Model
+        std::vector<Chain> chains;       // chainIndex(replica, temperature)
+        std::vector<std::uint64_t> swaps_proposed;
+        std::vector<std::uint64_t> swaps_accepted;
+        std::size_t step_count = 0;
+        bool initialized = false;
+
+        // k-th pair of uniform numbers in [0, 1) of (chain, step, purpose)
+        std::array<double, 2> uniforms(std::size_t chain, std::size_t step, std::uint32_t purpose, std::uint32_t k) const {
+            const std::array<std::uint32_t, 4> r = philox4x32({static_cast<std::uint32_t>(chain), static_cast<std::uint32_t>(step),
+                                                               static_cast<std::uint32_t>(step >> 32), (purpose << 28) | k},
+                                                              {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)});
+            return {static_cast<double>(((std::uint64_t(r[0]) << 32) | r[1]) >> 11)*0x1.0p-53,
+                    static_cast<double>(((std::uint64_t(r[2]) << 32) | r[3]) >> 11)*0x1.0p-53};
+        }
+
+        // log-likelihood and constrained WCs at the position u
+        double evaluate(Model& model, const std::vector<double>& u, std::vector<double>& values) const {
+            std::vector<double> params(Model::num_params);
+            model.getParams(params.data());
+            for (std::size_t a = 0; a < axes.size(); a++) params[axis_params[a]] = axes[a].value(u[a]);
+            model.setParams(params.data());
+
+            double log_likelihood = 0.0;
+            values.resize(constraints.size());
+            if (fill) fill(model, values.data());
+            for (std::size_t i = 0; i < constraints.size(); i++) {
+                if (!fill) values[i] = constraints[i].func(model);
+                const double pull = (values[i] - constraints[i].mean)/constraints[i].sigma;
+                log_likelihood -= 0.5*pull*pull;
+            }
+            return std::isfinite(log_likelihood) ? log_likelihood : -INFINITY;
+        }
+
+        void advance(std::size_t c, Model& model) {
+            Chain& chain = chains[c];
+            const double beta = 1.0/temperatures[c % temperatures.size()];
+
+            // the initial point is redrawn, up to max_initial_draws times, until the likelihood is non-zero
+            if (!initialized) {
+                if (chain.step == 0.0) {
+                    chain.u.resize(axes.size());
+                    for (std::size_t draw = 0; draw < max_initial_draws; draw++) {
+                        for (std::size_t a = 0; a < axes.size(); a += 2) {
+                            const std::array<double, 2> r = uniforms(c, draw, rng_init, a/2);
+                            for (std::size_t k = a; k < std::min(a + 2, axes.size()); k++) chain.u[k] = r[k - a];
+                        }
+                        chain.log_likelihood = evaluate(model, chain.u, chain.values);
+                        if (chain.log_likelihood > -INFINITY) break;
+                    }
+                    chain.step = initial_step;
+                } else {
+                    chain.log_likelihood = evaluate(model, chain.u, chain.values);
+                }
+                return;
+            }
+
+            // Gaussian random walk (Box-Muller), proposals outside the unit cube have zero prior and are rejected
+            std::vector<double> proposal(axes.size());
+            bool inside = true;
+            for (std::size_t a = 0; a < axes.size(); a += 2) {
+                const std::array<double, 2> r = uniforms(c, step_count, rng_proposal, a/2);
+                const double radius = std::sqrt(-2.0*std::log1p(-r[0]));
+                const std::array<double, 2> normal = {radius*std::cos(2.0*std::numbers::pi*r[1]), radius*std::sin(2.0*std::numbers::pi*r[1])};
+                for (std::size_t k = a; k < std::min(a + 2, axes.size()); k++) {
+                    proposal[k] = chain.u[k] + chain.step*normal[k - a];
+                    inside = inside && proposal[k] >= 0.0 && proposal[k] <= 1.0;
+                }
+            }
+
+            chain.proposed++;
+            chain.window_proposed++;
+            if (!inside) return;
+
+            // a proposal of zero likelihood is never accepted, a chain stuck at zero likelihood accepts any other proposal
+            std::vector<double> values;
+            const double log_likelihood = evaluate(model, proposal, values);
+            if (log_likelihood == -INFINITY) return;
+            if (chain.log_likelihood == -INFINITY || std::log(uniforms(c, step_count, rng_accept, 0)[0]) < beta*(log_likelihood - chain.log_likelihood)) {
+                chain.u = std::move(proposal);
+                chain.values = std::move(values);
+                chain.log_likelihood = log_likelihood;
+                chain.accepted++;
+                chain.window_accepted++;
+            }
+        }
+
+        // exchanges, adaptation, output and checkpoint after all chains have made step step_count
+        void finishStep(const std::function<void(std::size_t, std::size_t, const double*)>& sink) {
+            const std::size_t num_temperatures = temperatures.size();
+
+            // even steps exchange the pairs (0, 1), (2, 3), ..., odd steps the pairs (1, 2), (3, 4), ...
+            for (std::size_t r = 0; r < num_replicas; r++) {
+                for (std::size_t k = step_count % 2; k + 1 < num_temperatures; k += 2) {
+                    Chain& cold = chains[chainIndex(r, k)];
+                    Chain& hot = chains[chainIndex(r, k + 1)];
+                    const double log_ratio = (1.0/temperatures[k] - 1.0/temperatures[k + 1])*(hot.log_likelihood - cold.log_likelihood);
+                    swaps_proposed[k]++;
+                    if (std::log(uniforms(r, step_count, rng_swap, k)[0]) < log_ratio) {
+                        std::swap(cold.u, hot.u);
+                        std::swap(cold.values, hot.values);
+                        std::swap(cold.log_likelihood, hot.log_likelihood);
+                        swaps_accepted[k]++;
+                    }
+                }
+            }
+
+            if (step_count < burn_in && (step_count + 1) % adapt_every == 0) {
+                for (Chain& chain : chains) {
+                    const double rate = static_cast<double>(chain.window_accepted)/std::max<std::uint64_t>(chain.window_proposed, 1);
+                    chain.step = std::clamp(chain.step*std::exp(2.0*(rate - 0.25)), 1e-6, 1.0);
+                    chain.window_proposed = 0;
+                    chain.window_accepted = 0;
+                }
+            }
+
+            if (step_count >= burn_in && sink) {
+                std::vector<double> row(axes.size() + 1 + constraints.size());
+                for (std::size_t r = 0; r < num_replicas; r++) {
+                    const Chain& chain = chains[chainIndex(r, 0)];
+                    for (std::size_t a = 0; a < axes.size(); a++) row[a] = axes[a].value(chain.u[a]);
+                    row[axes.size()] = chain.log_likelihood;
+                    std::copy(chain.values.begin(), chain.values.end(), row.begin() + axes.size() + 1);
+                    sink(step_count, r, row.data());
+                }
+            }
+
+            step_count++;
+            if (!checkpoint_path.empty() && checkpoint_every > 0 && step_count % checkpoint_every == 0) saveCheckpoint(checkpoint_path);
+        }
+
+        template <class T>
+        static void write(std::ofstream& file, const std::vector<T>& v) {
+            file.write(reinterpret_cast<const char*>(v.data()), v.size()*sizeof(T));
+        }
+
+        template <class T>
+        static void read(std::ifstream& file, std::vector<T>& v) {
+            file.read(reinterpret_cast<char*>(v.data()), v.size()*sizeof(T));
+        }
+};
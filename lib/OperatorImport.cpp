@@ -15,6 +15,18 @@
 #include <stdexcept>
 #include <tuple>
 #include <functional>
+#include <span>
+#include <unordered_map>
+#include <array>
+#include <initializer_list>
+#include <string>
+
+#ifdef OPERATOR_PROFILE
+#include <iostream>
+#include <format>
+#include <map>
+#include <mutex>
+#endif
 
 using std::vector;
 using std::transform;
@@ -22,876 +34,1483 @@ using std::accumulate;
 using std::variant;
 using std::invalid_argument;
 
-LoopFunc::LoopFunc(vector<variant<vector<double>, double> > list_of_masses, int code, double mubarsq) {
-  for (variant<vector<double>, double> mass_vec: list_of_masses) {
+LoopFunc::LoopFunc(vector<variant<MassVec, double> > list_of_masses, int code, double mubarsq) {
+  for (variant<MassVec, double> mass_vec: list_of_masses) {
     this->masses.emplace_back(mass_vec);
   }
   this->code = code;
   this->mubarsq = mubarsq;
 }
 
-// elaborate definitions of loop-functions in terms of masses
-double LF(vector<double> masses, int code, double mubarsq) {
-    switch(code) {
-        case 1:
-            return pow(masses[0],2)*(1 + log(mubarsq/pow(masses[0],2)));
-            break;
-        case 2:
-            return 1 + log(mubarsq/pow(masses[0],2));
-            break;
-        case 3:
-            return (1 + log(mubarsq/pow(masses[0],2)))/pow(masses[0],2);
-            break;
-        case 4:
-            return pow(masses[0],2)*(1 + 2*log(mubarsq/pow(masses[0],2)));
-            break;
-        case 5:
-            return log(mubarsq/pow(masses[0],2));
-            break;
-        case 6:
-            return -pow(masses[0],-2);
-            break;
-        case 7:
-            return -0.5 + log(mubarsq/pow(masses[0],2));
-            break;
-        case 8:
-            return -0.5*1/pow(masses[0],2);
-            break;
-        case 9:
-            return -0.8333333333333334 + log(mubarsq/pow(masses[0],2));
-            break;
-        case 10:
-            return -0.3333333333333333*1/pow(masses[0],2);
-            break;
-        case 11:
-            return 1/(6*pow(masses[0],4));
-            break;
-        case 12:
-            return -0.25*1/pow(masses[0],2);
-            break;
-        case 13:
-            return 1/(12*pow(masses[0],4));
-            break;
-        case 14:
-            return -0.08333333333333333*1/pow(masses[0],6);
-            break;
-        case 15:
-            return -0.2*1/pow(masses[0],2);
-            break;
-        case 16:
-            return 1/(20*pow(masses[0],4));
-            break;
-        case 17:
-            return -0.03333333333333333*1/pow(masses[0],6);
-            break;
-        case 18:
-            return 1/(20*pow(masses[0],8));
-            break;
-        case 19:
-            if (masses[0] == masses[1]) { return LF({masses[0]},4,mubarsq); }
-            else { return (pow(masses[0],4) - pow(masses[1],4) + pow(masses[0],4)*log(mubarsq/pow(masses[0],2)) - pow(masses[1],4)*log(mubarsq/pow(masses[1],2)))/(pow(masses[0],2) - pow(masses[1],2)); }
-            break;
-        case 20:
-            if (masses[0] == masses[1]) { return LF({masses[0]},5,mubarsq); }
-            else { return (pow(masses[0],2) - pow(masses[1],2) + pow(masses[0],2)*log(mubarsq/pow(masses[0],2)) - pow(masses[1],2)*log(mubarsq/pow(masses[1],2)))/(pow(masses[0],2) - pow(masses[1],2)); }
-            break;
-        case 21:
-            if (masses[0] == masses[1]) { return LF({masses[0]},7,mubarsq); }
-            else { return (pow(masses[0],4) - pow(masses[0],2)*pow(masses[1],2) + pow(masses[0],4)*log(mubarsq/pow(masses[0],2)) + (-2*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4))*log(mubarsq/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),2); }
-            break;
-        case 22:
-            if (masses[0] == masses[1]) { return LF({masses[0]},8,mubarsq); }
-            else { return (pow(masses[0],2) - pow(masses[1],2) - pow(masses[0],2)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),2); }
-            break;
-        case 23:
-            if (masses[0] == masses[1]) { return LF({masses[0]},10,mubarsq); }
-            else { return (3*pow(masses[0],4) - 4*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4) - 2*pow(masses[0],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),3)); }
-            break;
-        case 24:
-            if (masses[0] == masses[1]) { return LF({masses[0]},11,mubarsq); }
-            else { return (-pow(masses[0],4) + pow(masses[1],4) + 2*pow(masses[0],2)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(masses[1],2)*pow(-pow(masses[0],2) + pow(masses[1],2),3)); }
-            break;
-        case 25:
-            if (masses[0] == masses[1]) { return LF({masses[0]},13,mubarsq); }
-            else { return (2*pow(masses[0],6) + 3*pow(masses[0],4)*pow(masses[1],2) - 6*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6) - 6*pow(masses[0],4)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(6*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 26:
-            if (masses[0] == masses[1]) { return LF({masses[0]},14,mubarsq); }
-            else { return -0.16666666666666666*(pow(masses[0],6) - 6*pow(masses[0],4)*pow(masses[1],2) + 3*pow(masses[0],2)*pow(masses[1],4) + 2*pow(masses[1],6) + 6*pow(masses[0],2)*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(-(pow(masses[0],2)*masses[1]) + pow(masses[1],3),4); }
-            break;
-        case 27:
-            if (masses[0] == masses[1]) { return LF({masses[0]},18,mubarsq); }
-            else { return (-pow(masses[0],8) + 6*pow(masses[0],6)*pow(masses[1],2) - 18*pow(masses[0],4)*pow(masses[1],4) + 10*pow(masses[0],2)*pow(masses[1],6) + 3*pow(masses[1],8) + 12*pow(masses[0],2)*pow(masses[1],6)*log(pow(masses[0],2)/pow(masses[1],2)))/(12*pow(masses[1],6)*pow(-pow(masses[0],2) + pow(masses[1],2),5)); }
-            break;
-        case 28:
-            if (masses[0] == masses[1]) { return LF({masses[0]},7,mubarsq); }
-            else { return (-(pow(masses[0],2)*pow(masses[1],2)) + pow(masses[1],4) + (pow(masses[0],4) - 2*pow(masses[0],2)*pow(masses[1],2))*log(mubarsq/pow(masses[0],2)) + pow(masses[1],4)*log(mubarsq/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),2); }
-            break;
-        case 29:
-            if (masses[0] == masses[1]) { return LF({masses[0]},8,mubarsq); }
-            else { return (-pow(masses[0],2) + pow(masses[1],2) + pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),2); }
-            break;
-        case 30:
-            if (masses[0] == masses[1]) { return LF({masses[0]},9,mubarsq); }
-            else { return (-2*pow(masses[0],4)*pow(masses[1],2) + 2*pow(masses[0],2)*pow(masses[1],4) + (pow(masses[0],6) - 3*pow(masses[0],4)*pow(masses[1],2))*log(mubarsq/pow(masses[0],2)) + (3*pow(masses[0],2)*pow(masses[1],4) - pow(masses[1],6))*log(mubarsq/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),3); }
-            break;
-        case 31:
-            if (masses[0] == masses[1]) { return LF({masses[0]},10,mubarsq); }
-            else { return (-pow(masses[0],4) + pow(masses[1],4) + 2*pow(masses[0],2)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),3); }
-            break;
-        case 32:
-            if (masses[0] == masses[1]) { return LF({masses[0]},11,mubarsq); }
-            else { return (-2*pow(masses[0],2) + 2*pow(masses[1],2) + (pow(masses[0],2) + pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),3); }
-            break;
-        case 33:
-            if (masses[0] == masses[1]) { return LF({masses[0]},12,mubarsq); }
-            else { return -0.5*(2*pow(masses[0],6) + 3*pow(masses[0],4)*pow(masses[1],2) - 6*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6) - 6*pow(masses[0],4)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),4); }
-            break;
-        case 34:
-            if (masses[0] == masses[1]) { return LF({masses[0]},13,mubarsq); }
-            else { return (-5*pow(masses[0],4) + 4*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4) + 2*(pow(masses[0],4) + 2*pow(masses[0],2)*pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 35:
-            if (masses[0] == masses[1]) { return LF({masses[0]},14,mubarsq); }
-            else { return -0.5*(pow(masses[0],4) + 4*pow(masses[0],2)*pow(masses[1],2) - 5*pow(masses[1],4) - 2*(2*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4))*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 36:
-            if (masses[0] == masses[1]) { return LF({masses[0]},17,mubarsq); }
-            else { return (pow(masses[0],6) + 9*pow(masses[0],4)*pow(masses[1],2) - 9*pow(masses[0],2)*pow(masses[1],4) - pow(masses[1],6) - 6*pow(masses[0],2)*pow(masses[1],2)*(pow(masses[0],2) + pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(3*pow(masses[1],2)*pow(-pow(masses[0],2) + pow(masses[1],2),5)); }
-            break;
-        case 37:
-            if (masses[0] == masses[1]) { return LF({masses[0]},18,mubarsq); }
-            else { return -0.16666666666666666*(pow(masses[0],6) - 9*pow(masses[0],4)*pow(masses[1],2) - 9*pow(masses[0],2)*pow(masses[1],4) + 17*pow(masses[1],6) + 6*(3*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6))*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(masses[1],4)*pow(-pow(masses[0],2) + pow(masses[1],2),5)); }
-            break;
-        case 38:
-            if (masses[0] == masses[1]) { return LF({masses[0]},9,mubarsq); }
-            else { return (-pow(masses[0],6) + 2*pow(masses[0],4)*pow(masses[1],2) + pow(masses[0],2)*pow(masses[1],4) - 2*pow(masses[1],6) + 2*(pow(masses[0],6) - 3*pow(masses[0],4)*pow(masses[1],2) + 3*pow(masses[0],2)*pow(masses[1],4))*log(mubarsq/pow(masses[0],2)) - 2*pow(masses[1],6)*log(mubarsq/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),3)); }
-            break;
-        case 39:
-            if (masses[0] == masses[1]) { return LF({masses[0]},10,mubarsq); }
-            else { return -0.5*(pow(masses[0],4) - 4*pow(masses[0],2)*pow(masses[1],2) + 3*pow(masses[1],4) + 2*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),3); }
-            break;
-        case 40:
-            if (masses[0] == masses[1]) { return LF({masses[0]},11,mubarsq); }
-            else { return (pow(masses[0],4) - pow(masses[1],4) - 2*pow(masses[0],2)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),3)); }
-            break;
-        case 41:
-            if (masses[0] == masses[1]) { return LF({masses[0]},12,mubarsq); }
-            else { return -0.5*(pow(masses[0],6) - 6*pow(masses[0],4)*pow(masses[1],2) + 3*pow(masses[0],2)*pow(masses[1],4) + 2*pow(masses[1],6) + 6*pow(masses[0],2)*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),4); }
-            break;
-        case 42:
-            if (masses[0] == masses[1]) { return LF({masses[0]},13,mubarsq); }
-            else { return (pow(masses[0],4) + 4*pow(masses[0],2)*pow(masses[1],2) - 5*pow(masses[1],4) - 2*(2*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4))*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 43:
-            if (masses[0] == masses[1]) { return LF({masses[0]},14,mubarsq); }
-            else { return -0.5*(-5*pow(masses[0],4) + 4*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4) + 2*(pow(masses[0],4) + 2*pow(masses[0],2)*pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 44:
-            if (masses[0] == masses[1]) { return LF({masses[0]},15,mubarsq); }
-            else { return (-pow(masses[0],8) + 8*pow(masses[0],6)*pow(masses[1],2) - 8*pow(masses[0],2)*pow(masses[1],6) + pow(masses[1],8) - 12*pow(masses[0],4)*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 45:
-            if (masses[0] == masses[1]) { return LF({masses[0]},16,mubarsq); }
-            else { return (pow(masses[0],6) + 9*pow(masses[0],4)*pow(masses[1],2) - 9*pow(masses[0],2)*pow(masses[1],4) - pow(masses[1],6) - 6*pow(masses[0],2)*pow(masses[1],2)*(pow(masses[0],2) + pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 46:
-            if (masses[0] == masses[1]) { return LF({masses[0]},17,mubarsq); }
-            else { return (3*(pow(masses[0],4) - pow(masses[1],4)) - (pow(masses[0],4) + 4*pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],4))*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),5); }
-            break;
-        case 47:
-            if (masses[0] == masses[1]) { return LF({masses[0]},18,mubarsq); }
-            else { return (pow(masses[0],6) + 9*pow(masses[0],4)*pow(masses[1],2) - 9*pow(masses[0],2)*pow(masses[1],4) - pow(masses[1],6) - 6*pow(masses[0],2)*pow(masses[1],2)*(pow(masses[0],2) + pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(2*pow(masses[0],2)*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 48:
-            if (masses[0] == masses[1]) { return LF({masses[0]},12,mubarsq); }
-            else { return (-2*pow(masses[0],6) + 9*pow(masses[0],4)*pow(masses[1],2) - 18*pow(masses[0],2)*pow(masses[1],4) + 11*pow(masses[1],6) + 6*pow(masses[1],6)*log(pow(masses[0],2)/pow(masses[1],2)))/(6*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 49:
-            if (masses[0] == masses[1]) { return LF({masses[0]},13,mubarsq); }
-            else { return (pow(masses[0],6) - 6*pow(masses[0],4)*pow(masses[1],2) + 3*pow(masses[0],2)*pow(masses[1],4) + 2*pow(masses[1],6) + 6*pow(masses[0],2)*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(6*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),4)); }
-            break;
-        case 50:
-            if (masses[0] == masses[1]) { return LF({masses[0]},14,mubarsq); }
-            else { return -0.16666666666666666*(2*pow(masses[0],6) + 3*pow(masses[0],4)*pow(masses[1],2) - 6*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6) - 6*pow(masses[0],4)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],3) - masses[0]*pow(masses[1],2),4); }
-            break;
-        case 51:
-            if (masses[0] == masses[1]) { return LF({masses[0]},15,mubarsq); }
-            else { return (-pow(masses[0],8) + 6*pow(masses[0],6)*pow(masses[1],2) - 18*pow(masses[0],4)*pow(masses[1],4) + 10*pow(masses[0],2)*pow(masses[1],6) + 3*pow(masses[1],8) + 12*pow(masses[0],2)*pow(masses[1],6)*log(pow(masses[0],2)/pow(masses[1],2)))/(3*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 52:
-            if (masses[0] == masses[1]) { return LF({masses[0]},16,mubarsq); }
-            else { return (pow(masses[0],6) - 9*pow(masses[0],4)*pow(masses[1],2) - 9*pow(masses[0],2)*pow(masses[1],4) + 17*pow(masses[1],6) + 6*(3*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6))*log(pow(masses[0],2)/pow(masses[1],2)))/(6*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 53:
-            if (masses[0] == masses[1]) { return LF({masses[0]},17,mubarsq); }
-            else { return (-pow(masses[0],6) - 9*pow(masses[0],4)*pow(masses[1],2) + 9*pow(masses[0],2)*pow(masses[1],4) + pow(masses[1],6) + 6*pow(masses[0],2)*pow(masses[1],2)*(pow(masses[0],2) + pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(3*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 54:
-            if (masses[0] == masses[1]) { return LF({masses[0]},18,mubarsq); }
-            else { return (-17*pow(masses[0],6) + 9*pow(masses[0],4)*pow(masses[1],2) + 9*pow(masses[0],2)*pow(masses[1],4) - pow(masses[1],6) + 6*(pow(masses[0],6) + 3*pow(masses[0],4)*pow(masses[1],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(6*pow(masses[0],4)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 55:
-            if (masses[0] == masses[1]) { return LF({masses[0]},15,mubarsq); }
-            else { return -0.08333333333333333*(3*pow(masses[0],8) - 16*pow(masses[0],6)*pow(masses[1],2) + 36*pow(masses[0],4)*pow(masses[1],4) - 48*pow(masses[0],2)*pow(masses[1],6) + 25*pow(masses[1],8) + 12*pow(masses[1],8)*log(pow(masses[0],2)/pow(masses[1],2)))/pow(pow(masses[0],2) - pow(masses[1],2),5); }
-            break;
-        case 56:
-            if (masses[0] == masses[1]) { return LF({masses[0]},16,mubarsq); }
-            else { return (pow(masses[0],8) - 6*pow(masses[0],6)*pow(masses[1],2) + 18*pow(masses[0],4)*pow(masses[1],4) - 10*pow(masses[0],2)*pow(masses[1],6) - 3*pow(masses[1],8) - 12*pow(masses[0],2)*pow(masses[1],6)*log(pow(masses[0],2)/pow(masses[1],2)))/(12*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 57:
-            if (masses[0] == masses[1]) { return LF({masses[0]},17,mubarsq); }
-            else { return (-pow(masses[0],8) + 8*pow(masses[0],6)*pow(masses[1],2) - 8*pow(masses[0],2)*pow(masses[1],6) + pow(masses[1],8) - 12*pow(masses[0],4)*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(12*pow(masses[0],4)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 58:
-            if (masses[0] == masses[1]) { return LF({masses[0]},18,mubarsq); }
-            else { return -0.08333333333333333*(-3*pow(masses[0],8) - 10*pow(masses[0],6)*pow(masses[1],2) + 18*pow(masses[0],4)*pow(masses[1],4) - 6*pow(masses[0],2)*pow(masses[1],6) + pow(masses[1],8) + 12*pow(masses[0],6)*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(masses[0],6)*pow(pow(masses[0],2) - pow(masses[1],2),5)); }
-            break;
-        case 59:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},28,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},28,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},21,mubarsq); }
-            else { return (pow(masses[0],4)*(pow(masses[1],2) - pow(masses[2],2))*log(mubarsq/pow(masses[0],2)) + pow(masses[1],4)*(-pow(masses[0],2) + pow(masses[2],2))*log(mubarsq/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) + pow(masses[2],4)*log(mubarsq/pow(masses[2],2))))/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 60:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},29,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},29,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},22,mubarsq); }
-            else { return (pow(masses[1],2)*(-pow(masses[0],2) + pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2)))/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 61:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},31,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},39,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},23,mubarsq); }
-            else { return ((pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(-pow(masses[0],2) + pow(masses[1],2)) + (pow(masses[2],2)*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2)) - (pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/pow(pow(masses[0],2) - pow(masses[2],2),2))/pow(pow(masses[1],2) - pow(masses[2],2),2); }
-            break;
-        case 62:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},32,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},40,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},24,mubarsq); }
-            else { return ((pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(-pow(masses[0],2) + pow(masses[1],2)) + ((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2)) + (pow(masses[0],2)*pow(masses[1],2) - pow(masses[2],4))*log(pow(masses[0],2)/pow(masses[2],2)))/pow(pow(masses[0],2) - pow(masses[2],2),2))/pow(pow(masses[1],2) - pow(masses[2],2),2); }
-            break;
-        case 63:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},34,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},49,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},25,mubarsq); }
-            else { return ((2*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(-pow(masses[0],2) + pow(masses[1],2)) + (-((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[0],2)*(-3*pow(masses[1],2) + pow(masses[2],2)) + pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)))) + 2*(pow(masses[0],4)*pow(masses[1],4) + pow(masses[1],2)*pow(masses[2],6) + pow(masses[0],2)*(-3*pow(masses[1],2)*pow(masses[2],4) + pow(masses[2],6)))*log(pow(masses[0],2)/pow(masses[2],2)))/pow(pow(masses[0],2) - pow(masses[2],2),3))/(2*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 64:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},35,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},50,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},26,mubarsq); }
-            else { return (2*pow(masses[1],2)*pow(masses[2],2)*pow(-pow(masses[0],2) + pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[2],2)*(pow(masses[1],2) - 3*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) - 2*pow(masses[2],2)*(pow(masses[0],4)*pow(masses[1],2) + pow(masses[2],6) + pow(masses[0],2)*(pow(masses[1],4) - 3*pow(masses[1],2)*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(2*(pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 65:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},37,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},58,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},27,mubarsq); }
-            else { return (-6*pow(masses[1],2)*pow(-(pow(masses[0],2)*masses[2]) + pow(masses[2],3),4)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(2*pow(masses[1],4)*pow(masses[2],4) - 7*pow(masses[1],2)*pow(masses[2],6) + 11*pow(masses[2],8) + pow(masses[0],4)*(-pow(masses[1],4) + 5*pow(masses[1],2)*pow(masses[2],2) + 2*pow(masses[2],4)) + pow(masses[0],2)*(5*pow(masses[1],4)*pow(masses[2],2) - 10*pow(masses[1],2)*pow(masses[2],4) - 7*pow(masses[2],6))) + 6*pow(masses[2],4)*(pow(masses[0],6)*pow(masses[1],2) - pow(masses[2],8) + pow(masses[0],4)*(pow(masses[1],4) - 4*pow(masses[1],2)*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],6) - 4*pow(masses[1],4)*pow(masses[2],2) + 6*pow(masses[1],2)*pow(masses[2],4)))*log(pow(masses[0],2)/pow(masses[2],2))))/(6*(pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],4)*pow(pow(masses[0],2) - pow(masses[2],2),4)*pow(pow(masses[1],2) - pow(masses[2],2),4)); }
-            break;
-        case 66:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},39,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},31,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},23,mubarsq); }
-            else { return (pow(masses[1],2)*(-2*pow(masses[0],2)*pow(masses[2],4) + pow(masses[1],2)*pow(masses[2],4) - pow(masses[0],4)*(pow(masses[1],2) - 2*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*(pow(masses[1],2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) + (-pow(masses[0],2) + pow(masses[1],2))*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 67:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},40,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},32,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},24,mubarsq); }
-            else { return ((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],4) + pow(masses[0],2)*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) + (-pow(masses[0],2) + pow(masses[1],2))*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 68:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},42,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},42,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},25,mubarsq); }
-            else { return (-(pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],4) - 2*pow(masses[0],2)*pow(masses[2],2) + pow(masses[1],2)*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2))) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-2*pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) - (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*(2*pow(masses[0],2)*pow(masses[1],2) - pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 69:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},43,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},43,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},26,mubarsq); }
-            else { return (pow(pow(masses[0],2) - pow(masses[2],2),2)*(-2*pow(masses[1],4) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(2*pow(masses[0],2) - pow(masses[1],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2)) + (pow(masses[0],2) - pow(masses[1],2))*(-2*pow(masses[2],4) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 70:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},47,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},54,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},27,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),3)) + 1/(2*(pow(masses[0],2) - pow(masses[2],2))*pow(-(pow(masses[1],2)*masses[2]) + pow(masses[2],3),2)) + log(pow(masses[0],2)/pow(masses[1],2))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),3)) - (pow(masses[1],2)*(-3*pow(masses[0],2) + 4*pow(masses[1],2) - pow(masses[2],2))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),4)) + ((2*pow(masses[0],2) + pow(masses[1],2) - 3*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[2],2)))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(-pow(masses[1],2) + pow(masses[2],2),3)) - (pow(masses[2],2)*(3*pow(masses[0],4) + pow(masses[1],4) - 4*pow(masses[1],2)*pow(masses[2],2) + 6*pow(masses[2],4) + 2*pow(masses[0],2)*(pow(masses[1],2) - 4*pow(masses[2],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),4)); }
-            break;
-        case 71:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},49,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},34,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},25,mubarsq); }
-            else { return (-2*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],6)*pow(masses[2],2) + pow(masses[0],4)*pow(masses[2],4) + pow(masses[0],2)*(pow(masses[1],6) - 3*pow(masses[1],4)*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],2)*(pow(masses[1],2) - 3*pow(masses[2],2)) + pow(masses[1],2)*(pow(masses[1],2) + pow(masses[2],2))) + 2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),3)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 72:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},50,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},35,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},26,mubarsq); }
-            else { return (2*pow(masses[1],2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],6) - 3*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*pow(masses[2],2)*(pow(masses[0],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-3*pow(masses[1],4) + pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) - 2*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(masses[1],2)*pow(-pow(masses[0],2) + pow(masses[1],2),3)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 73:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},54,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},47,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},27,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)) + 1/(2*(pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[1],3) - masses[1]*pow(masses[2],2),2)) + ((2*pow(masses[0],2) - 3*pow(masses[1],2) + pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)) + (pow(masses[1],2)*(3*pow(masses[0],4) + 6*pow(masses[1],4) - 4*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4) + pow(masses[0],2)*(-8*pow(masses[1],2) + 2*pow(masses[2],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(-pow(masses[0],2) + pow(masses[1],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),4)) + log(pow(masses[0],2)/pow(masses[2],2))/((-pow(masses[0],2) + pow(masses[2],2))*pow(-pow(masses[1],2) + pow(masses[2],2),3)) - (pow(masses[2],2)*(-3*pow(masses[0],2) - pow(masses[1],2) + 4*pow(masses[2],2))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),4)); }
-            break;
-        case 74:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},58,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},37,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},27,mubarsq); }
-            else { return (6*pow(masses[1],4)*(pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],8) + 6*pow(masses[0],2)*pow(masses[1],4)*pow(masses[2],2) - 4*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2)*(pow(masses[0],2) + pow(masses[2],2)) + pow(masses[0],2)*pow(masses[2],2)*(pow(masses[0],4) + pow(masses[0],2)*pow(masses[2],2) + pow(masses[2],4)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(-11*pow(masses[1],8) + 7*pow(masses[1],6)*pow(masses[2],2) - 2*pow(masses[1],4)*pow(masses[2],4) + pow(masses[0],4)*(-2*pow(masses[1],4) - 5*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4)) + pow(masses[0],2)*(7*pow(masses[1],6) + 10*pow(masses[1],4)*pow(masses[2],2) - 5*pow(masses[1],2)*pow(masses[2],4))) + 6*pow(masses[1],4)*pow(-pow(masses[0],2) + pow(masses[1],2),3)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(6*pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[1],2),4)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[2],2),4)); }
-            break;
-        case 75:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},38,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},38,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},30,mubarsq); }
-            else { return (pow(masses[0],4)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],4) + 3*pow(masses[1],2)*pow(masses[2],2) - 2*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(mubarsq/pow(masses[0],2)) + pow(masses[1],6)*pow(pow(masses[0],2) - pow(masses[2],2),2)*log(mubarsq/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-(pow(masses[1],2)*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],6)*log(mubarsq/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 76:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},39,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},39,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},31,mubarsq); }
-            else { return (pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),2)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 77:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},40,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},40,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},32,mubarsq); }
-            else { return (pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 78:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},41,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},48,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},33,mubarsq); }
-            else { return (pow(masses[1],6)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[0],2)*pow(masses[2],4) - pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(-pow(masses[1],2) + pow(masses[2],2))) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],4)*(-(pow(masses[1],2)*pow(masses[2],2)) + pow(masses[0],2)*(3*pow(masses[1],2) - 2*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 79:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},42,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},49,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},34,mubarsq); }
-            else { return (pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2))) + (pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*(-pow(masses[2],4) + pow(masses[0],2)*(2*pow(masses[1],2) - pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 80:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},43,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},50,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},35,mubarsq); }
-            else { return (pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - 2*pow(masses[1],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2)) + (pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2)*pow(masses[1],2) + pow(masses[1],2)*pow(masses[2],2) - 2*pow(masses[2],4))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 81:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},47,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},58,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},37,mubarsq); }
-            else { return (2*pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)) + ((pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-5*pow(masses[1],4)*pow(masses[2],2) + 9*pow(masses[1],2)*pow(masses[2],4) - 2*pow(masses[2],6) + pow(masses[0],4)*(pow(masses[1],2) + pow(masses[2],2)) - pow(masses[0],2)*(pow(masses[1],4) - 2*pow(masses[1],2)*pow(masses[2],2) + 5*pow(masses[2],4))) - 2*(pow(masses[0],2) - pow(masses[1],2))*pow(masses[2],2)*(pow(masses[0],4)*pow(masses[1],2) + 2*pow(masses[0],2)*(pow(masses[1],4) - 2*pow(masses[1],2)*pow(masses[2],2)) + pow(masses[2],2)*(pow(masses[1],4) - 3*pow(masses[1],2)*pow(masses[2],2) + 3*pow(masses[2],4)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(masses[2],2)*pow(pow(masses[0],2) - pow(masses[2],2),4)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 82:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},48,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},41,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},33,mubarsq); }
-            else { return (pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(2*pow(masses[1],2) - 3*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(-(pow(masses[0],2)*pow(masses[1],4)) + pow(masses[1],4)*pow(masses[2],2) + pow(masses[0],4)*(-pow(masses[1],2) + pow(masses[2],2))) - pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],6)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 83:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},49,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},42,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},34,mubarsq); }
-            else { return (pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],4) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2))) - pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 84:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},50,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},43,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},35,mubarsq); }
-            else { return -((pow(pow(masses[0],2) - pow(masses[2],2),2)*(-2*pow(masses[1],4) + pow(masses[0],2)*pow(masses[2],2) + pow(masses[1],2)*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) + pow(masses[1],2) - 2*pow(masses[2],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2)) - pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2))); }
-            break;
-        case 85:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},53,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},53,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},36,mubarsq); }
-            else { return (2*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],4) - pow(masses[0],2)*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],4)*(pow(masses[1],2) + pow(masses[2],2)) + pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],4) - 6*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) - 2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],2)*(pow(masses[0],2)*pow(masses[1],2) - pow(masses[2],4))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 86:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},54,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},54,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},37,mubarsq); }
-            else { return (-(pow(pow(masses[0],2) - pow(masses[2],2),3)*(-3*pow(masses[1],4) + pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2))) + (pow(masses[0],2) - pow(masses[1],2))*(2*(pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[0],4) + pow(masses[1],4) - pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4) - pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) + pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[2],2)*(pow(masses[1],2) - 3*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 87:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},57,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},46,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},36,mubarsq); }
-            else { return (2*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[1],8) + pow(masses[0],4)*pow(masses[2],4) + 2*pow(masses[0],2)*pow(masses[1],2)*(pow(masses[1],4) - 3*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4)))*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-3*pow(masses[1],4)*pow(masses[2],2) + pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(pow(masses[1],2) - 3*pow(masses[2],2)) + pow(masses[0],2)*(5*pow(masses[1],4) - 6*pow(masses[1],2)*pow(masses[2],2) + 5*pow(masses[2],4))) + 2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 88:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},58,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},47,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},37,mubarsq); }
-            else { return (2*(3*pow(masses[1],6) - 3*pow(masses[1],4)*pow(masses[2],2) + pow(masses[0],2)*pow(masses[2],2)*(pow(masses[0],2) + 2*pow(masses[2],2)) + pow(masses[1],2)*(-4*pow(masses[0],2)*pow(masses[2],2) + pow(masses[2],4)))*log(pow(masses[0],2)/pow(masses[1],2)) + ((pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-2*pow(masses[1],6) + 9*pow(masses[1],4)*pow(masses[2],2) - 5*pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(pow(masses[1],2) + pow(masses[2],2)) - pow(masses[0],2)*(5*pow(masses[1],4) - 2*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) + 2*pow(masses[1],2)*pow(-pow(masses[0],2) + pow(masses[1],2),3)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),2)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[1],2) - pow(masses[2],2),3)); }
-            break;
-        case 89:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},48,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},48,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},41,mubarsq); }
-            else { return -0.5*(2*pow(masses[1],6)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],4) + 5*pow(masses[1],2)*pow(masses[2],2) - 3*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) - 2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],6)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 90:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},49,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},49,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},42,mubarsq); }
-            else { return (-2*pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],4) - 3*pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) + 2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 91:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},50,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},50,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},43,mubarsq); }
-            else { return (-2*pow(masses[0],2)*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(3*pow(masses[0],4) - pow(masses[1],2)*pow(masses[2],2) - pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))) + 2*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 92:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},53,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},57,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},46,mubarsq); }
-            else { return (-2*pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),4)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(5*pow(masses[1],4)*pow(masses[2],2) - 3*pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(-3*pow(masses[1],2) + 5*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],4) - 6*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) + 2*pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(masses[2],2)*(pow(masses[2],2)*(pow(masses[1],2) - 2*pow(masses[2],2)) + pow(masses[0],2)*(2*pow(masses[1],2) - pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),4)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 93:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},54,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},58,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},47,mubarsq); }
-            else { return (-2*pow(masses[0],2)*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),4)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(2*pow(masses[0],6) + pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) - pow(masses[2],2)) + pow(masses[0],4)*(-9*pow(masses[1],2) + 5*pow(masses[2],2)) + pow(masses[0],2)*(5*pow(masses[1],4) - 2*pow(masses[1],2)*pow(masses[2],2) - pow(masses[2],4))) + 2*pow(pow(masses[0],3) - masses[0]*pow(masses[1],2),2)*(pow(masses[0],2)*pow(masses[1],2) + 2*pow(masses[1],2)*pow(masses[2],2) - 3*pow(masses[2],4))*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),4)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 94:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},55,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},51,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},44,mubarsq); }
-            else { return -0.5*(2*pow(masses[1],6)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(3*pow(masses[1],2) - 4*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(-4*pow(masses[0],2)*pow(masses[1],6)*pow(masses[2],2) + 2*pow(masses[1],6)*pow(masses[2],4) + pow(masses[0],8)*(-pow(masses[1],2) + pow(masses[2],2)) + pow(masses[0],6)*(5*pow(masses[1],4) - 2*pow(masses[1],2)*pow(masses[2],2) - 3*pow(masses[2],4)) + pow(masses[0],4)*(2*pow(masses[1],6) - 7*pow(masses[1],4)*pow(masses[2],2) + 7*pow(masses[1],2)*pow(masses[2],4))) + 2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],8)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 95:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},56,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},52,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},45,mubarsq); }
-            else { return (-2*pow(masses[1],4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[1],4) + pow(masses[0],2)*(2*pow(masses[1],2) - 3*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(-2*pow(masses[1],4)*pow(masses[2],4) + pow(masses[0],6)*(-pow(masses[1],2) + pow(masses[2],2)) + pow(masses[0],4)*(-5*pow(masses[1],4) + 2*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4)) + pow(masses[0],2)*(9*pow(masses[1],4)*pow(masses[2],2) - 5*pow(masses[1],2)*pow(masses[2],4))) - 2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],6)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 96:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},57,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},53,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},46,mubarsq); }
-            else { return (-2*pow(masses[1],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*(2*pow(masses[1],4) - pow(masses[1],2)*pow(masses[2],2) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2)))*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(-3*pow(masses[1],4)*pow(masses[2],2) + 5*pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(5*pow(masses[1],2) - 3*pow(masses[2],2)) + pow(masses[0],2)*(pow(masses[1],4) - 6*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) - 2*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 97:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},58,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},54,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},47,mubarsq); }
-            else { return (2*(-3*pow(masses[1],4) + pow(masses[0],2)*pow(masses[2],2) + 2*pow(masses[1],2)*pow(masses[2],2))*log(pow(masses[0],2)/pow(masses[1],2)) + ((pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(2*pow(masses[0],6) - pow(masses[1],4)*pow(masses[2],2) + pow(masses[1],2)*pow(masses[2],4) + pow(masses[0],4)*(5*pow(masses[1],2) - 9*pow(masses[2],2)) - pow(masses[0],2)*(pow(masses[1],4) + 2*pow(masses[1],2)*pow(masses[2],2) - 5*pow(masses[2],4))) - 2*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[2],2),3)))/(2*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[1],2) - pow(masses[2],2),2)); }
-            break;
-        case 98:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},55,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},55,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},51,mubarsq); }
-            else { return (6*pow(masses[1],8)*pow(pow(masses[0],2) - pow(masses[2],2),4)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(2*pow(masses[0],8) + 26*pow(masses[1],4)*pow(masses[2],4) - 7*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2)) - 31*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)) + pow(masses[0],4)*(11*pow(masses[1],4) + 26*pow(masses[1],2)*pow(masses[2],2) + 11*pow(masses[2],4))) + 6*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],8)*log(pow(masses[0],2)/pow(masses[2],2))))/(6*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),4)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 99:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},56,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},56,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},52,mubarsq); }
-            else { return (6*pow(masses[1],6)*pow(pow(masses[0],2) - pow(masses[2],2),4)*log(pow(masses[0],2)/pow(masses[1],2)) + (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[0],8) - 11*pow(masses[1],4)*pow(masses[2],4) - 5*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2)) + 7*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)) - 2*pow(masses[0],4)*(pow(masses[1],4) - 5*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) - 6*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],6)*log(pow(masses[0],2)/pow(masses[2],2))))/(6*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),4)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 100:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},57,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},57,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},53,mubarsq); }
-            else { return (6*pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)) - ((pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(2*pow(masses[0],8) + 2*pow(masses[1],4)*pow(masses[2],4) + 5*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2)) + 5*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)) - pow(masses[0],4)*(pow(masses[1],4) + 22*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) + 6*pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],4)*log(pow(masses[0],2)/pow(masses[2],2))))/(pow(masses[0],2)*pow(pow(masses[0],2) - pow(masses[2],2),4)))/(6*pow(pow(masses[0],2) - pow(masses[1],2),4)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 101:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2]},58,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1]},58,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1]},54,mubarsq); }
-            else { return (6*pow(masses[1],2)*pow(pow(masses[0],3) - masses[0]*pow(masses[2],2),4)*log(pow(masses[0],2)/pow(masses[1],2)) - (pow(masses[0],2) - pow(masses[1],2))*((pow(masses[0],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[2],2))*(11*pow(masses[0],8) - pow(masses[1],4)*pow(masses[2],4) - 7*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2)) + 5*pow(masses[0],2)*pow(masses[1],2)*pow(masses[2],2)*(pow(masses[1],2) + pow(masses[2],2)) + 2*pow(masses[0],4)*(pow(masses[1],4) - 5*pow(masses[1],2)*pow(masses[2],2) + pow(masses[2],4))) + 6*pow(masses[0],4)*pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(masses[2],2)*log(pow(masses[0],2)/pow(masses[2],2))))/(6*pow(masses[0],4)*pow(pow(masses[0],2) - pow(masses[1],2),4)*pow(pow(masses[0],2) - pow(masses[2],2),4)*(pow(masses[1],2) - pow(masses[2],2))); }
-            break;
-        case 102:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},76,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},76,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},76,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},66,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},66,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},61,mubarsq); }
-            else { return ((pow(masses[1],4)*log(pow(masses[0],2)/pow(masses[1],2)))/(-pow(masses[0],2) + pow(masses[1],2)) + ((pow(masses[2],4)*(pow(masses[1],2) - pow(masses[3],2))*log(pow(masses[0],2)/pow(masses[2],2)))/(pow(masses[0],2) - pow(masses[2],2)) + ((pow(masses[1],2) - pow(masses[2],2))*pow(masses[3],4)*log(pow(masses[0],2)/pow(masses[3],2)))/(-pow(masses[0],2) + pow(masses[3],2)))/(pow(masses[2],2) - pow(masses[3],2)))/((pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))); }
-            break;
-        case 103:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},77,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},77,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},77,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},67,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},67,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},62,mubarsq); }
-            else { return ((pow(masses[1],2)*log(pow(masses[0],2)/pow(masses[1],2)))/(-pow(masses[0],2) + pow(masses[1],2)) + ((pow(masses[2],2)*(pow(masses[1],2) - pow(masses[3],2))*log(pow(masses[0],2)/pow(masses[2],2)))/(pow(masses[0],2) - pow(masses[2],2)) + ((pow(masses[1],2) - pow(masses[2],2))*pow(masses[3],2)*log(pow(masses[0],2)/pow(masses[3],2)))/(-pow(masses[0],2) + pow(masses[3],2)))/(pow(masses[2],2) - pow(masses[3],2)))/((pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))); }
-            break;
-        case 104:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},79,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},79,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},90,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},68,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},71,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},63,mubarsq); }
-            else { return pow(masses[0],4)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],4)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)) - (pow(masses[3],4)*(-2*pow(masses[2],2)*pow(masses[3],2) + 3*pow(masses[3],4) + pow(masses[1],2)*(pow(masses[2],2) - 2*pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) - 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) + (pow(masses[3],2)*(1 + 2*log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 105:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},80,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},80,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},91,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},69,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},72,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},64,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[3],2))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))) - (pow(masses[3],2)*(-2*pow(masses[2],2)*pow(masses[3],2) + 3*pow(masses[3],4) + pow(masses[1],2)*(pow(masses[2],2) - 2*pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) - 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)); }
-            break;
-        case 106:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},81,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},81,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},101,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},70,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},74,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},65,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[0],2) - pow(masses[3],2),3)) - 1/(2*pow(masses[3],2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),3)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),3)) - ((-2*pow(masses[2],2)*pow(masses[3],2) + 3*pow(masses[3],4) + pow(masses[1],2)*(pow(masses[2],2) - 2*pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) - 2*pow(masses[3],2)))*log(pow(masses[0],2)/pow(masses[3],2)))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) - (pow(masses[3],2)*(3*pow(masses[2],4)*pow(masses[3],4) - 8*pow(masses[2],2)*pow(masses[3],6) + 6*pow(masses[3],8) + pow(masses[1],4)*(pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + 3*pow(masses[3],4)) + pow(masses[1],2)*(-3*pow(masses[2],4)*pow(masses[3],2) + 9*pow(masses[2],2)*pow(masses[3],4) - 8*pow(masses[3],6)) + pow(masses[0],4)*(pow(masses[1],4) + pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + 3*pow(masses[3],4) + pow(masses[1],2)*(pow(masses[2],2) - 3*pow(masses[3],2))) + pow(masses[0],2)*(-3*pow(masses[2],4)*pow(masses[3],2) + 9*pow(masses[2],2)*pow(masses[3],4) - 8*pow(masses[3],6) + pow(masses[1],4)*(pow(masses[2],2) - 3*pow(masses[3],2)) + pow(masses[1],2)*pow(pow(masses[2],2) - 3*pow(masses[3],2),2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),3)*pow(-pow(masses[1],2) + pow(masses[3],2),3)*pow(-pow(masses[2],2) + pow(masses[3],2),3)); }
-            break;
-        case 107:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},83,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},90,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},79,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},71,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},68,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},63,mubarsq); }
-            else { return pow(masses[0],4)/((pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[0],2) - pow(masses[3],2))) + (pow(masses[1],4)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[3],2))) - (pow(masses[2],4)*(3*pow(masses[2],4) - 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(-2*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) + (pow(masses[2],2)*(1 + 2*log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))); }
-            break;
-        case 108:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},84,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},91,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},80,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},72,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},69,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},64,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[0],2) - pow(masses[3],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[3],2))) + log(pow(masses[0],2)/pow(masses[2],2))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) - (pow(masses[2],2)*(3*pow(masses[2],4) - 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(-2*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))); }
-            break;
-        case 109:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},86,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},93,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},93,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},73,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},73,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},65,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[2],2))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)) - (pow(masses[2],2)*(4*pow(masses[2],4) - 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(-3*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(2*pow(masses[1],2) - 3*pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),3)) + log(pow(masses[0],2)/pow(masses[3],2))/(pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))) - (pow(masses[3],2)*(-2*pow(masses[2],2)*pow(masses[3],2) + 4*pow(masses[3],4) + pow(masses[1],2)*(pow(masses[2],2) - 3*pow(masses[3],2)) + pow(masses[0],2)*(2*pow(masses[1],2) + pow(masses[2],2) - 3*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(-pow(masses[2],2) + pow(masses[3],2),3)); }
-            break;
-        case 110:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},88,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},81,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},74,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},70,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},65,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[0],2) - pow(masses[2],2),3)*(pow(masses[0],2) - pow(masses[3],2))) - 1/(2*pow(masses[2],2)*(-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),3)*(pow(masses[1],2) - pow(masses[3],2))) - ((3*pow(masses[2],4) - 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(-2*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2) + pow(masses[3],2)))*log(pow(masses[0],2)/pow(masses[2],2)))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) - (pow(masses[2],2)*(6*pow(masses[2],8) - 8*pow(masses[2],6)*pow(masses[3],2) + 3*pow(masses[2],4)*pow(masses[3],4) + pow(masses[1],4)*(3*pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4)) + pow(masses[1],2)*(-8*pow(masses[2],6) + 9*pow(masses[2],4)*pow(masses[3],2) - 3*pow(masses[2],2)*pow(masses[3],4)) + pow(masses[0],4)*(pow(masses[1],4) + 3*pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4) + pow(masses[1],2)*(-3*pow(masses[2],2) + pow(masses[3],2))) + pow(masses[0],2)*(-8*pow(masses[2],6) + 9*pow(masses[2],4)*pow(masses[3],2) - 3*pow(masses[2],2)*pow(masses[3],4) + pow(masses[1],4)*(-3*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[1],2)*pow(-3*pow(masses[2],2) + pow(masses[3],2),2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(-pow(masses[1],2) + pow(masses[2],2),3)*pow(pow(masses[2],2) - pow(masses[3],2),3)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*pow(-pow(masses[2],2) + pow(masses[3],2),3)); }
-            break;
-        case 111:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},90,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},83,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},83,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},71,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},71,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},68,mubarsq); }
-            else { return pow(masses[0],4)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - (pow(masses[1],4)*(3*pow(masses[1],4) + pow(masses[2],2)*pow(masses[3],2) - 2*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[1],2)*(1 + 2*log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[1],2) - pow(masses[2],2),2)*(-pow(masses[0],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 112:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},91,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},84,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},84,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},72,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},72,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},69,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) + log(pow(masses[0],2)/pow(masses[1],2))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) - (pow(masses[1],2)*(3*pow(masses[1],4) + pow(masses[2],2)*pow(masses[3],2) - 2*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[1],2) - pow(masses[2],2),2)*(-pow(masses[0],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 113:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},93,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},86,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},97,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},73,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},74,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},70,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[0],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[1],2))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),2)) - (pow(masses[1],2)*(4*pow(masses[1],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[0],2)*(-3*pow(masses[1],2) + 2*pow(masses[2],2) + pow(masses[3],2)) - pow(masses[1],2)*(3*pow(masses[2],2) + 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),3)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[1],2) - pow(masses[2],2),2)*(-pow(masses[0],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[3],2))/(pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))) - (pow(masses[3],2)*(-3*pow(masses[2],2)*pow(masses[3],2) + 4*pow(masses[3],4) + pow(masses[0],2)*(pow(masses[1],2) + 2*pow(masses[2],2) - 3*pow(masses[3],2)) + pow(masses[1],2)*(pow(masses[2],2) - 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)*pow(-pow(masses[1],2) + pow(masses[3],2),3)); }
-            break;
-        case 114:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},97,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},97,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},86,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},74,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},73,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},70,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[0],2) - pow(masses[3],2))) + log(pow(masses[0],2)/pow(masses[1],2))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[3],2))) - (pow(masses[1],2)*(4*pow(masses[1],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[0],2)*(-3*pow(masses[1],2) + pow(masses[2],2) + 2*pow(masses[3],2)) - pow(masses[1],2)*(2*pow(masses[2],2) + 3*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[2],2))/(pow(pow(masses[1],2) - pow(masses[2],2),2)*(-pow(masses[0],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) - (pow(masses[2],2)*(4*pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(-2*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) - 3*pow(masses[2],2) + 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(-pow(masses[1],2) + pow(masses[2],2),3)*pow(pow(masses[2],2) - pow(masses[3],2),2)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))); }
-            break;
-        case 115:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},88,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},88,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},74,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},74,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},73,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),3)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - 1/(2*pow(masses[1],2)*(-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + ((-3*pow(masses[1],4) - pow(masses[2],2)*pow(masses[3],2) + pow(masses[0],2)*(2*pow(masses[1],2) - pow(masses[2],2) - pow(masses[3],2)) + 2*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)))*log(pow(masses[0],2)/pow(masses[1],2)))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) - (pow(masses[1],2)*(6*pow(masses[1],8) + pow(masses[2],4)*pow(masses[3],4) - 8*pow(masses[1],6)*(pow(masses[2],2) + pow(masses[3],2)) - 3*pow(masses[1],2)*pow(masses[2],2)*pow(masses[3],2)*(pow(masses[2],2) + pow(masses[3],2)) + 3*pow(masses[1],4)*(pow(masses[2],4) + 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4)) + pow(masses[0],4)*(3*pow(masses[1],4) + pow(masses[2],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4) - 3*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2))) + pow(masses[0],2)*(-8*pow(masses[1],6) + 9*pow(masses[1],4)*(pow(masses[2],2) + pow(masses[3],2)) + pow(masses[2],2)*pow(masses[3],2)*(pow(masses[2],2) + pow(masses[3],2)) - 3*pow(masses[1],2)*pow(pow(masses[2],2) + pow(masses[3],2),2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[3],2),3)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*pow(-pow(masses[1],2) + pow(masses[2],2),3)*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*pow(-pow(masses[1],2) + pow(masses[3],2),3)*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 116:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},89,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},89,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},89,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},82,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},82,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},78,mubarsq); }
-            else { return (2*pow(masses[0],4))/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - (pow(masses[0],6)*(3*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - 2*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],6)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],6)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],6)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 117:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},90,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},90,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},90,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},83,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},83,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},79,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - (pow(masses[0],4)*(3*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - 2*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],4)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 118:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},91,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},91,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},91,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},84,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},84,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},80,mubarsq); }
-            else { return -((pow(masses[0],2)*(3*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - 2*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 119:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},93,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},93,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},101,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},86,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},88,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},81,mubarsq); }
-            else { return -((pow(masses[0],2)*(4*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(2*pow(masses[2],2) + pow(masses[3],2)) - pow(masses[0],2)*(3*pow(masses[1],2) + 3*pow(masses[2],2) + 2*pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),3))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)) + log(pow(masses[0],2)/pow(masses[3],2))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))) + (pow(masses[3],2)*(-3*pow(masses[2],2)*pow(masses[3],2) + 4*pow(masses[3],4) + pow(masses[1],2)*(2*pow(masses[2],2) - 3*pow(masses[3],2)) + pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) - 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),3)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)); }
-            break;
-        case 120:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},97,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},93,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},88,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},86,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},81,mubarsq); }
-            else { return -((pow(masses[0],2)*(4*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + 2*pow(masses[3],2)) - pow(masses[0],2)*(3*pow(masses[1],2) + 2*pow(masses[2],2) + 3*pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[0],2) - pow(masses[3],2),2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[3],2))) + log(pow(masses[0],2)/pow(masses[2],2))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[2],2)*(4*pow(masses[2],4) - 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[0],2)*(pow(masses[1],2) - 2*pow(masses[2],2) + pow(masses[3],2)) + pow(masses[1],2)*(-3*pow(masses[2],2) + 2*pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))); }
-            break;
-        case 121:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},100,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},96,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},96,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},87,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},87,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},85,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - (pow(masses[0],4)*(4*pow(masses[0],4) + 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - pow(masses[0],2)*(2*pow(masses[1],2) + 3*(pow(masses[2],2) + pow(masses[3],2)))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[1],4)*(4*pow(masses[1],4) + 2*pow(masses[2],2)*pow(masses[3],2) - 3*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[1],2)*(1 + 2*log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 122:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},97,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},97,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},88,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},88,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},86,mubarsq); }
-            else { return -((pow(masses[0],2)*(4*pow(masses[0],4) + 2*pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - pow(masses[0],2)*(2*pow(masses[1],2) + 3*(pow(masses[2],2) + pow(masses[3],2)))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2))) + log(pow(masses[0],2)/pow(masses[1],2))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[1],2)*(4*pow(masses[1],4) + 2*pow(masses[2],2)*pow(masses[3],2) - 3*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) + pow(masses[0],2)*(-2*pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 123:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},100,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},100,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},100,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},96,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},96,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},92,mubarsq); }
-            else { return -0.5*1/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) - (pow(masses[0],2)*(3*pow(masses[0],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)) - 2*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)) + (pow(masses[0],4)*(6*pow(masses[0],8) + pow(masses[2],4)*pow(masses[3],4) + pow(masses[1],2)*pow(masses[2],2)*pow(masses[3],2)*(pow(masses[2],2) + pow(masses[3],2)) - 3*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))*(pow(masses[1],2) + pow(masses[3],2))*(pow(masses[2],2) + pow(masses[3],2)) - 8*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)) + pow(masses[1],4)*(pow(masses[2],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4)) + 3*pow(masses[0],4)*(pow(masses[1],4) + pow(masses[2],4) + 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4) + 3*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[0],2) - pow(masses[3],2),3)) + (pow(masses[1],4)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(-pow(masses[0],2) + pow(masses[1],2),3)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(-pow(masses[0],2) + pow(masses[2],2),3)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(-pow(masses[0],2) + pow(masses[3],2),3)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 124:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3]},101,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2]},101,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3]},97,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2]},97,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2]},93,mubarsq); }
-            else { return -0.5*1/(pow(masses[0],2)*(pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))) + (pow(masses[0],2)*(6*pow(masses[0],8) + pow(masses[2],4)*pow(masses[3],4) + pow(masses[1],2)*pow(masses[2],2)*pow(masses[3],2)*(pow(masses[2],2) + pow(masses[3],2)) - 3*pow(masses[0],2)*(pow(masses[1],2) + pow(masses[2],2))*(pow(masses[1],2) + pow(masses[3],2))*(pow(masses[2],2) + pow(masses[3],2)) - 8*pow(masses[0],6)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2)) + pow(masses[1],4)*(pow(masses[2],4) + pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4)) + 3*pow(masses[0],4)*(pow(masses[1],4) + pow(masses[2],4) + 3*pow(masses[2],2)*pow(masses[3],2) + pow(masses[3],4) + 3*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2)))))/(pow(pow(masses[0],2) - pow(masses[1],2),3)*pow(pow(masses[0],2) - pow(masses[2],2),3)*pow(pow(masses[0],2) - pow(masses[3],2),3)) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(-pow(masses[0],2) + pow(masses[1],2),3)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(-pow(masses[0],2) + pow(masses[2],2),3)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(-pow(masses[0],2) + pow(masses[3],2),3)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))); }
-            break;
-        case 125:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},117,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},117,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},117,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},117,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},111,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},111,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},111,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},107,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},107,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},104,mubarsq); }
-            else { return pow(masses[0],4)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))*(pow(masses[0],2) - pow(masses[4],2))) + (pow(masses[1],4)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))) + (pow(masses[2],4)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))) + (pow(masses[3],4)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) + (pow(masses[4],4)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/((-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))); }
-            break;
-        case 126:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},118,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},118,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},118,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},118,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},112,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},112,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},112,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},108,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},108,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},105,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))*(pow(masses[0],2) - pow(masses[4],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/((-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))); }
-            break;
-        case 127:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},119,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},119,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},119,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},124,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},113,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},113,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},115,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},109,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},110,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},106,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))*pow(pow(masses[0],2) - pow(masses[4],2),2)) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*pow(pow(masses[1],2) - pow(masses[4],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*pow(pow(masses[2],2) - pow(masses[4],2),2)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*pow(pow(masses[3],2) - pow(masses[4],2),2)) + log(pow(masses[0],2)/pow(masses[4],2))/((-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))) - (pow(masses[4],2)*(2*pow(masses[2],2)*pow(masses[3],2)*pow(masses[4],2) - 3*pow(masses[2],2)*pow(masses[4],4) - 3*pow(masses[3],2)*pow(masses[4],4) + 4*pow(masses[4],6) + pow(masses[1],2)*(2*pow(masses[3],2)*pow(masses[4],2) - 3*pow(masses[4],4) - pow(masses[2],2)*(pow(masses[3],2) - 2*pow(masses[4],2))) - pow(masses[0],2)*(-2*pow(masses[3],2)*pow(masses[4],2) + 3*pow(masses[4],4) + pow(masses[2],2)*(pow(masses[3],2) - 2*pow(masses[4],2)) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2) - 2*pow(masses[4],2))))*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/(pow(pow(masses[0],2) - pow(masses[4],2),2)*pow(pow(masses[1],2) - pow(masses[4],2),2)*pow(pow(masses[2],2) - pow(masses[4],2),2)*pow(pow(masses[3],2) - pow(masses[4],2),2)); }
-            break;
-        case 128:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},120,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},120,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},119,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},114,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},115,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},113,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},110,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},109,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},106,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*pow(pow(masses[0],2) - pow(masses[3],2),2)*(pow(masses[0],2) - pow(masses[4],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*pow(pow(masses[1],2) - pow(masses[3],2),2)*(pow(masses[1],2) - pow(masses[4],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*pow(pow(masses[2],2) - pow(masses[3],2),2)*(pow(masses[2],2) - pow(masses[4],2))) + log(pow(masses[0],2)/pow(masses[3],2))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) - (pow(masses[3],2)*(-3*pow(masses[2],2)*pow(masses[3],4) + 4*pow(masses[3],6) + 2*pow(masses[2],2)*pow(masses[3],2)*pow(masses[4],2) - 3*pow(masses[3],4)*pow(masses[4],2) + pow(masses[1],2)*(-3*pow(masses[3],4) + 2*pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(2*pow(masses[3],2) - pow(masses[4],2))) - pow(masses[0],2)*(3*pow(masses[3],4) - 2*pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(-2*pow(masses[3],2) + pow(masses[4],2)) + pow(masses[1],2)*(pow(masses[2],2) - 2*pow(masses[3],2) + pow(masses[4],2))))*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)*pow(pow(masses[3],2) - pow(masses[4],2),2)) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/(pow(pow(masses[3],2) - pow(masses[4],2),2)*(-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))); }
-            break;
-        case 129:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},122,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},120,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},120,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},115,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},114,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},114,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},110,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},110,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},109,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*pow(pow(masses[0],2) - pow(masses[2],2),2)*(pow(masses[0],2) - pow(masses[3],2))*(pow(masses[0],2) - pow(masses[4],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*pow(pow(masses[1],2) - pow(masses[2],2),2)*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))) + log(pow(masses[0],2)/pow(masses[2],2))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))) - (pow(masses[2],2)*(4*pow(masses[2],6) - 3*pow(masses[2],4)*pow(masses[3],2) - 3*pow(masses[2],4)*pow(masses[4],2) + 2*pow(masses[2],2)*pow(masses[3],2)*pow(masses[4],2) + pow(masses[1],2)*(-3*pow(masses[2],4) - pow(masses[3],2)*pow(masses[4],2) + 2*pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2))) + pow(masses[0],2)*(-3*pow(masses[2],4) - pow(masses[3],2)*pow(masses[4],2) + pow(masses[1],2)*(2*pow(masses[2],2) - pow(masses[3],2) - pow(masses[4],2)) + 2*pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2))))*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[2],2) - pow(masses[3],2),2)*pow(pow(masses[2],2) - pow(masses[4],2),2)) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[2],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/(pow(pow(masses[2],2) - pow(masses[4],2),2)*(-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))); }
-            break;
-        case 130:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},122,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},122,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},122,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},115,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},115,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},115,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},114,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},114,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},113,mubarsq); }
-            else { return pow(masses[0],2)/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))*(pow(masses[0],2) - pow(masses[4],2))) + log(pow(masses[0],2)/pow(masses[1],2))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))) - (pow(masses[1],2)*(4*pow(masses[1],6) - pow(masses[2],2)*pow(masses[3],2)*pow(masses[4],2) - 3*pow(masses[1],4)*(pow(masses[2],2) + pow(masses[3],2) + pow(masses[4],2)) + 2*pow(masses[1],2)*(pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2))) - pow(masses[0],2)*(3*pow(masses[1],4) + pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2)) - 2*pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2) + pow(masses[4],2))))*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[1],2) - pow(masses[2],2),2)*pow(pow(masses[1],2) - pow(masses[3],2),2)*pow(pow(masses[1],2) - pow(masses[4],2),2)) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[1],2) - pow(masses[2],2),2)*(-pow(masses[0],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[1],2) - pow(masses[3],2),2)*(-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/(pow(pow(masses[1],2) - pow(masses[4],2),2)*(-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))); }
-            break;
-        case 131:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},124,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},124,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4]},122,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},122,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},122,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4]},120,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},120,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3]},119,mubarsq); }
-            else { return (pow(masses[0],2)*(-4*pow(masses[0],6) + pow(masses[2],2)*pow(masses[3],2)*pow(masses[4],2) + 3*pow(masses[0],4)*(pow(masses[1],2) + pow(masses[2],2) + pow(masses[3],2) + pow(masses[4],2)) + pow(masses[1],2)*(pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2))) - 2*pow(masses[0],2)*(pow(masses[3],2)*pow(masses[4],2) + pow(masses[2],2)*(pow(masses[3],2) + pow(masses[4],2)) + pow(masses[1],2)*(pow(masses[2],2) + pow(masses[3],2) + pow(masses[4],2)))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*pow(pow(masses[0],2) - pow(masses[2],2),2)*pow(pow(masses[0],2) - pow(masses[3],2),2)*pow(pow(masses[0],2) - pow(masses[4],2),2)) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/(pow(pow(masses[0],2) - pow(masses[1],2),2)*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/(pow(pow(masses[0],2) - pow(masses[2],2),2)*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/(pow(pow(masses[0],2) - pow(masses[3],2),2)*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/(pow(pow(masses[0],2) - pow(masses[4],2),2)*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))); }
-            break;
-        case 132:
-            if (masses[0] == masses[1]) { return LF({masses[0],masses[2],masses[3],masses[4],masses[5]},131,mubarsq); }
-            else if (masses[0] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4],masses[5]},131,mubarsq); }
-            else if (masses[0] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4],masses[5]},131,mubarsq); }
-            else if (masses[0] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[5]},131,mubarsq); }
-            else if (masses[0] == masses[5]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[4]},131,mubarsq); }
-            else if (masses[1] == masses[2]) { return LF({masses[0],masses[1],masses[3],masses[4],masses[5]},130,mubarsq); }
-            else if (masses[1] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4],masses[5]},130,mubarsq); }
-            else if (masses[1] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[5]},130,mubarsq); }
-            else if (masses[1] == masses[5]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[4]},130,mubarsq); }
-            else if (masses[2] == masses[3]) { return LF({masses[0],masses[1],masses[2],masses[4],masses[5]},129,mubarsq); }
-            else if (masses[2] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[5]},129,mubarsq); }
-            else if (masses[2] == masses[5]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[4]},129,mubarsq); }
-            else if (masses[3] == masses[4]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[5]},128,mubarsq); }
-            else if (masses[3] == masses[5]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[4]},128,mubarsq); }
-            else if (masses[4] == masses[5]) { return LF({masses[0],masses[1],masses[2],masses[3],masses[4]},127,mubarsq); }
-            else { return pow(masses[0],2)/((pow(masses[0],2) - pow(masses[1],2))*(pow(masses[0],2) - pow(masses[2],2))*(pow(masses[0],2) - pow(masses[3],2))*(pow(masses[0],2) - pow(masses[4],2))*(pow(masses[0],2) - pow(masses[5],2))) + (pow(masses[1],2)*(1 + log(pow(masses[0],2)/pow(masses[1],2))))/((-pow(masses[0],2) + pow(masses[1],2))*(pow(masses[1],2) - pow(masses[2],2))*(pow(masses[1],2) - pow(masses[3],2))*(pow(masses[1],2) - pow(masses[4],2))*(pow(masses[1],2) - pow(masses[5],2))) + (pow(masses[2],2)*(1 + log(pow(masses[0],2)/pow(masses[2],2))))/((-pow(masses[0],2) + pow(masses[2],2))*(-pow(masses[1],2) + pow(masses[2],2))*(pow(masses[2],2) - pow(masses[3],2))*(pow(masses[2],2) - pow(masses[4],2))*(pow(masses[2],2) - pow(masses[5],2))) + (pow(masses[3],2)*(1 + log(pow(masses[0],2)/pow(masses[3],2))))/((-pow(masses[0],2) + pow(masses[3],2))*(-pow(masses[1],2) + pow(masses[3],2))*(-pow(masses[2],2) + pow(masses[3],2))*(pow(masses[3],2) - pow(masses[4],2))*(pow(masses[3],2) - pow(masses[5],2))) + (pow(masses[4],2)*(1 + log(pow(masses[0],2)/pow(masses[4],2))))/((-pow(masses[0],2) + pow(masses[4],2))*(-pow(masses[1],2) + pow(masses[4],2))*(-pow(masses[2],2) + pow(masses[4],2))*(-pow(masses[3],2) + pow(masses[4],2))*(pow(masses[4],2) - pow(masses[5],2))) + (pow(masses[5],2)*(1 + log(pow(masses[0],2)/pow(masses[5],2))))/((-pow(masses[0],2) + pow(masses[5],2))*(-pow(masses[1],2) + pow(masses[5],2))*(-pow(masses[2],2) + pow(masses[5],2))*(-pow(masses[3],2) + pow(masses[5],2))*(-pow(masses[4],2) + pow(masses[5],2))); }
-            break;
-        default:
-            return 0.0;
+// arithmetic of the dual numbers, the derivatives follow from the chain rule
+Dual operator-(const Dual& a) {
+    Dual res(-a.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = -a.der[j];
+    return res;
+}
+
+Dual operator+(const Dual& a, const Dual& b) {
+    Dual res(a.val + b.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j] + b.der[j];
+    return res;
+}
+
+Dual operator+(const Dual& a, double b) {
+    Dual res = a;
+    res.val += b;
+    return res;
+}
+
+Dual operator+(double a, const Dual& b) { return b + a; }
+
+Dual operator-(const Dual& a, const Dual& b) {
+    Dual res(a.val - b.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j] - b.der[j];
+    return res;
+}
+
+Dual operator-(const Dual& a, double b) { return a + (-b); }
+
+Dual operator-(double a, const Dual& b) { return -b + a; }
+
+Dual operator*(const Dual& a, const Dual& b) {
+    Dual res(a.val*b.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j]*b.val + a.val*b.der[j];
+    return res;
+}
+
+Dual operator*(const Dual& a, double b) {
+    Dual res(a.val*b);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j]*b;
+    return res;
+}
+
+Dual operator*(double a, const Dual& b) { return b*a; }
+
+Dual operator/(const Dual& a, const Dual& b) {
+    Dual res(a.val/b.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = (a.der[j] - res.val*b.der[j])/b.val;
+    return res;
+}
+
+Dual operator/(const Dual& a, double b) {
+    Dual res(a.val/b);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j]/b;
+    return res;
+}
+
+Dual operator/(double a, const Dual& b) {
+    Dual res(a/b.val);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = -res.val*b.der[j]/b.val;
+    return res;
+}
+
+Dual& operator+=(Dual& a, const Dual& b) {
+    a.val += b.val;
+    for (int j = 0; j < dual_directions; j++) a.der[j] += b.der[j];
+    return a;
+}
+
+Dual& operator-=(Dual& a, const Dual& b) {
+    a.val -= b.val;
+    for (int j = 0; j < dual_directions; j++) a.der[j] -= b.der[j];
+    return a;
+}
+
+bool operator==(const Dual& a, const Dual& b) { return a.val == b.val; }
+
+Dual pow(const Dual& a, double n) {
+    Dual res(pow(a.val, n));
+    const double d = n == 0.0 ? 0.0 : n*pow(a.val, n - 1);
+    for (int j = 0; j < dual_directions; j++) res.der[j] = d*a.der[j];
+    return res;
+}
+
+Dual sqrt(const Dual& a) {
+    Dual res(sqrt(a.val));
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j]/(2*res.val);
+    return res;
+}
+
+Dual log(const Dual& a) {
+    Dual res(log(a.val));
+    for (int j = 0; j < dual_directions; j++) res.der[j] = a.der[j]/a.val;
+    return res;
+}
+
+template <class T>
+BasicLFMass<T>::BasicLFMass(const T& m, double mubarsq) {
+    this->m = m;
+    this->sq = pow(m,2);
+    this->p4 = pow(m,4);
+    this->p6 = pow(m,6);
+    this->p8 = pow(m,8);
+    this->inv_sq = pow(m,-2);
+    this->lg = log(mubarsq/this->sq);
+}
+
+template struct BasicLFMass<double>;
+template struct BasicLFMass<Dual>;
+
+// direct-mapped table of the masses seen by the loop functions, a mass evicts the one in its slot on a collision
+// the slots are checked against (m, mubarsq), so that they never go stale when the parameters or the scale change
+struct LFMassSlot {
+    double mubarsq;
+    LFMass mass;
+};
+
+static constexpr int lf_mass_slots = 64;
+
+const LFMass& lfMass(double m, double mubarsq) {
+    static thread_local std::array<LFMassSlot, lf_mass_slots> slots = [](){
+        std::array<LFMassSlot, lf_mass_slots> res;
+        res.fill({std::nan(""), LFMass()});
+        return res;
+    }();
+
+    std::hash<double> h;
+    LFMassSlot& slot = slots[((h(m) ^ (h(mubarsq) >> 7))*0x9E3779B97F4A7C15ull) >> 58];
+    if (slot.mass.m != m || slot.mubarsq != mubarsq) slot = {mubarsq, LFMass(m, mubarsq)};
+    return slot.mass;
+}
+
+// elaborate definitions of loop-functions in terms of masses, one kernel per code, instantiated on double and on Dual
+// degenerate masses are handed to the kernel of the limiting code, on a copy of the masses kept on the stack
+template <class T>
+static T lf1(const BasicLFMass<T>* masses, double mubarsq) {
+    return masses[0].sq*(1 + masses[0].lg);
+}
+
+template <class T>
+static T lf2(const BasicLFMass<T>* masses, double mubarsq) {
+    return 1 + masses[0].lg;
+}
+
+template <class T>
+static T lf3(const BasicLFMass<T>* masses, double mubarsq) {
+    return (1 + masses[0].lg)/masses[0].sq;
+}
+
+template <class T>
+static T lf4(const BasicLFMass<T>* masses, double mubarsq) {
+    return masses[0].sq*(1 + 2*masses[0].lg);
+}
+
+template <class T>
+static T lf5(const BasicLFMass<T>* masses, double mubarsq) {
+    return masses[0].lg;
+}
+
+template <class T>
+static T lf6(const BasicLFMass<T>* masses, double mubarsq) {
+    return -masses[0].inv_sq;
+}
+
+template <class T>
+static T lf7(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.5 + masses[0].lg;
+}
+
+template <class T>
+static T lf8(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.5*1/masses[0].sq;
+}
+
+template <class T>
+static T lf9(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.8333333333333334 + masses[0].lg;
+}
+
+template <class T>
+static T lf10(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.3333333333333333*1/masses[0].sq;
+}
+
+template <class T>
+static T lf11(const BasicLFMass<T>* masses, double mubarsq) {
+    return 1/(6*masses[0].p4);
+}
+
+template <class T>
+static T lf12(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.25*1/masses[0].sq;
+}
+
+template <class T>
+static T lf13(const BasicLFMass<T>* masses, double mubarsq) {
+    return 1/(12*masses[0].p4);
+}
+
+template <class T>
+static T lf14(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.08333333333333333*1/masses[0].p6;
+}
+
+template <class T>
+static T lf15(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.2*1/masses[0].sq;
+}
+
+template <class T>
+static T lf16(const BasicLFMass<T>* masses, double mubarsq) {
+    return 1/(20*masses[0].p4);
+}
+
+template <class T>
+static T lf17(const BasicLFMass<T>* masses, double mubarsq) {
+    return -0.03333333333333333*1/masses[0].p6;
+}
+
+template <class T>
+static T lf18(const BasicLFMass<T>* masses, double mubarsq) {
+    return 1/(20*masses[0].p8);
+}
+
+template <class T>
+static T lf19(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf4(masses, mubarsq); }
+    else { return (masses[0].p4 - masses[1].p4 + masses[0].p4*masses[0].lg - masses[1].p4*masses[1].lg)/(masses[0].sq - masses[1].sq); }
+}
+
+template <class T>
+static T lf20(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf5(masses, mubarsq); }
+    else { return (masses[0].sq - masses[1].sq + masses[0].sq*masses[0].lg - masses[1].sq*masses[1].lg)/(masses[0].sq - masses[1].sq); }
+}
+
+template <class T>
+static T lf21(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf7(masses, mubarsq); }
+    else { return (masses[0].p4 - masses[0].sq*masses[1].sq + masses[0].p4*masses[0].lg + (-2*masses[0].sq*masses[1].sq + masses[1].p4)*masses[1].lg)/pow(masses[0].sq - masses[1].sq,2); }
+}
+
+template <class T>
+static T lf22(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf8(masses, mubarsq); }
+    else { return (masses[0].sq - masses[1].sq - masses[0].sq*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,2); }
+}
+
+template <class T>
+static T lf23(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf10(masses, mubarsq); }
+    else { return (3*masses[0].p4 - 4*masses[0].sq*masses[1].sq + masses[1].p4 - 2*masses[0].p4*log(masses[0].sq/masses[1].sq))/(2*pow(masses[0].sq - masses[1].sq,3)); }
+}
+
+template <class T>
+static T lf24(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf11(masses, mubarsq); }
+    else { return (-masses[0].p4 + masses[1].p4 + 2*masses[0].sq*masses[1].sq*log(masses[0].sq/masses[1].sq))/(2*masses[1].sq*pow(-masses[0].sq + masses[1].sq,3)); }
+}
+
+template <class T>
+static T lf25(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf13(masses, mubarsq); }
+    else { return (2*masses[0].p6 + 3*masses[0].p4*masses[1].sq - 6*masses[0].sq*masses[1].p4 + masses[1].p6 - 6*masses[0].p4*masses[1].sq*log(masses[0].sq/masses[1].sq))/(6*masses[1].sq*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf26(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf14(masses, mubarsq); }
+    else { return -0.16666666666666666*(masses[0].p6 - 6*masses[0].p4*masses[1].sq + 3*masses[0].sq*masses[1].p4 + 2*masses[1].p6 + 6*masses[0].sq*masses[1].p4*log(masses[0].sq/masses[1].sq))/pow(-(masses[0].sq*masses[1].m) + pow(masses[1].m,3),4); }
+}
+
+template <class T>
+static T lf27(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf18(masses, mubarsq); }
+    else { return (-masses[0].p8 + 6*masses[0].p6*masses[1].sq - 18*masses[0].p4*masses[1].p4 + 10*masses[0].sq*masses[1].p6 + 3*masses[1].p8 + 12*masses[0].sq*masses[1].p6*log(masses[0].sq/masses[1].sq))/(12*masses[1].p6*pow(-masses[0].sq + masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf28(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf7(masses, mubarsq); }
+    else { return (-(masses[0].sq*masses[1].sq) + masses[1].p4 + (masses[0].p4 - 2*masses[0].sq*masses[1].sq)*masses[0].lg + masses[1].p4*masses[1].lg)/pow(masses[0].sq - masses[1].sq,2); }
+}
+
+template <class T>
+static T lf29(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf8(masses, mubarsq); }
+    else { return (-masses[0].sq + masses[1].sq + masses[1].sq*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,2); }
+}
+
+template <class T>
+static T lf30(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf9(masses, mubarsq); }
+    else { return (-2*masses[0].p4*masses[1].sq + 2*masses[0].sq*masses[1].p4 + (masses[0].p6 - 3*masses[0].p4*masses[1].sq)*masses[0].lg + (3*masses[0].sq*masses[1].p4 - masses[1].p6)*masses[1].lg)/pow(masses[0].sq - masses[1].sq,3); }
+}
+
+template <class T>
+static T lf31(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf10(masses, mubarsq); }
+    else { return (-masses[0].p4 + masses[1].p4 + 2*masses[0].sq*masses[1].sq*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,3); }
+}
+
+template <class T>
+static T lf32(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf11(masses, mubarsq); }
+    else { return (-2*masses[0].sq + 2*masses[1].sq + (masses[0].sq + masses[1].sq)*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,3); }
+}
+
+template <class T>
+static T lf33(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf12(masses, mubarsq); }
+    else { return -0.5*(2*masses[0].p6 + 3*masses[0].p4*masses[1].sq - 6*masses[0].sq*masses[1].p4 + masses[1].p6 - 6*masses[0].p4*masses[1].sq*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,4); }
+}
+
+template <class T>
+static T lf34(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf13(masses, mubarsq); }
+    else { return (-5*masses[0].p4 + 4*masses[0].sq*masses[1].sq + masses[1].p4 + 2*(masses[0].p4 + 2*masses[0].sq*masses[1].sq)*log(masses[0].sq/masses[1].sq))/(2*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf35(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf14(masses, mubarsq); }
+    else { return -0.5*(masses[0].p4 + 4*masses[0].sq*masses[1].sq - 5*masses[1].p4 - 2*(2*masses[0].sq*masses[1].sq + masses[1].p4)*log(masses[0].sq/masses[1].sq))/(masses[1].sq*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf36(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf17(masses, mubarsq); }
+    else { return (masses[0].p6 + 9*masses[0].p4*masses[1].sq - 9*masses[0].sq*masses[1].p4 - masses[1].p6 - 6*masses[0].sq*masses[1].sq*(masses[0].sq + masses[1].sq)*log(masses[0].sq/masses[1].sq))/(3*masses[1].sq*pow(-masses[0].sq + masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf37(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf18(masses, mubarsq); }
+    else { return -0.16666666666666666*(masses[0].p6 - 9*masses[0].p4*masses[1].sq - 9*masses[0].sq*masses[1].p4 + 17*masses[1].p6 + 6*(3*masses[0].sq*masses[1].p4 + masses[1].p6)*log(masses[0].sq/masses[1].sq))/(masses[1].p4*pow(-masses[0].sq + masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf38(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf9(masses, mubarsq); }
+    else { return (-masses[0].p6 + 2*masses[0].p4*masses[1].sq + masses[0].sq*masses[1].p4 - 2*masses[1].p6 + 2*(masses[0].p6 - 3*masses[0].p4*masses[1].sq + 3*masses[0].sq*masses[1].p4)*masses[0].lg - 2*masses[1].p6*masses[1].lg)/(2*pow(masses[0].sq - masses[1].sq,3)); }
+}
+
+template <class T>
+static T lf39(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf10(masses, mubarsq); }
+    else { return -0.5*(masses[0].p4 - 4*masses[0].sq*masses[1].sq + 3*masses[1].p4 + 2*masses[1].p4*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,3); }
+}
+
+template <class T>
+static T lf40(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf11(masses, mubarsq); }
+    else { return (masses[0].p4 - masses[1].p4 - 2*masses[0].sq*masses[1].sq*log(masses[0].sq/masses[1].sq))/(2*masses[0].sq*pow(masses[0].sq - masses[1].sq,3)); }
+}
+
+template <class T>
+static T lf41(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf12(masses, mubarsq); }
+    else { return -0.5*(masses[0].p6 - 6*masses[0].p4*masses[1].sq + 3*masses[0].sq*masses[1].p4 + 2*masses[1].p6 + 6*masses[0].sq*masses[1].p4*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,4); }
+}
+
+template <class T>
+static T lf42(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf13(masses, mubarsq); }
+    else { return (masses[0].p4 + 4*masses[0].sq*masses[1].sq - 5*masses[1].p4 - 2*(2*masses[0].sq*masses[1].sq + masses[1].p4)*log(masses[0].sq/masses[1].sq))/(2*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf43(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf14(masses, mubarsq); }
+    else { return -0.5*(-5*masses[0].p4 + 4*masses[0].sq*masses[1].sq + masses[1].p4 + 2*(masses[0].p4 + 2*masses[0].sq*masses[1].sq)*log(masses[0].sq/masses[1].sq))/(masses[0].sq*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf44(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf15(masses, mubarsq); }
+    else { return (-masses[0].p8 + 8*masses[0].p6*masses[1].sq - 8*masses[0].sq*masses[1].p6 + masses[1].p8 - 12*masses[0].p4*masses[1].p4*log(masses[0].sq/masses[1].sq))/(2*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf45(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf16(masses, mubarsq); }
+    else { return (masses[0].p6 + 9*masses[0].p4*masses[1].sq - 9*masses[0].sq*masses[1].p4 - masses[1].p6 - 6*masses[0].sq*masses[1].sq*(masses[0].sq + masses[1].sq)*log(masses[0].sq/masses[1].sq))/(2*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf46(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf17(masses, mubarsq); }
+    else { return (3*(masses[0].p4 - masses[1].p4) - (masses[0].p4 + 4*masses[0].sq*masses[1].sq + masses[1].p4)*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,5); }
+}
+
+template <class T>
+static T lf47(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf18(masses, mubarsq); }
+    else { return (masses[0].p6 + 9*masses[0].p4*masses[1].sq - 9*masses[0].sq*masses[1].p4 - masses[1].p6 - 6*masses[0].sq*masses[1].sq*(masses[0].sq + masses[1].sq)*log(masses[0].sq/masses[1].sq))/(2*masses[0].sq*masses[1].sq*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf48(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf12(masses, mubarsq); }
+    else { return (-2*masses[0].p6 + 9*masses[0].p4*masses[1].sq - 18*masses[0].sq*masses[1].p4 + 11*masses[1].p6 + 6*masses[1].p6*log(masses[0].sq/masses[1].sq))/(6*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf49(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf13(masses, mubarsq); }
+    else { return (masses[0].p6 - 6*masses[0].p4*masses[1].sq + 3*masses[0].sq*masses[1].p4 + 2*masses[1].p6 + 6*masses[0].sq*masses[1].p4*log(masses[0].sq/masses[1].sq))/(6*masses[0].sq*pow(masses[0].sq - masses[1].sq,4)); }
+}
+
+template <class T>
+static T lf50(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf14(masses, mubarsq); }
+    else { return -0.16666666666666666*(2*masses[0].p6 + 3*masses[0].p4*masses[1].sq - 6*masses[0].sq*masses[1].p4 + masses[1].p6 - 6*masses[0].p4*masses[1].sq*log(masses[0].sq/masses[1].sq))/pow(pow(masses[0].m,3) - masses[0].m*masses[1].sq,4); }
+}
+
+template <class T>
+static T lf51(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf15(masses, mubarsq); }
+    else { return (-masses[0].p8 + 6*masses[0].p6*masses[1].sq - 18*masses[0].p4*masses[1].p4 + 10*masses[0].sq*masses[1].p6 + 3*masses[1].p8 + 12*masses[0].sq*masses[1].p6*log(masses[0].sq/masses[1].sq))/(3*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf52(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf16(masses, mubarsq); }
+    else { return (masses[0].p6 - 9*masses[0].p4*masses[1].sq - 9*masses[0].sq*masses[1].p4 + 17*masses[1].p6 + 6*(3*masses[0].sq*masses[1].p4 + masses[1].p6)*log(masses[0].sq/masses[1].sq))/(6*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf53(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf17(masses, mubarsq); }
+    else { return (-masses[0].p6 - 9*masses[0].p4*masses[1].sq + 9*masses[0].sq*masses[1].p4 + masses[1].p6 + 6*masses[0].sq*masses[1].sq*(masses[0].sq + masses[1].sq)*log(masses[0].sq/masses[1].sq))/(3*masses[0].sq*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf54(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf18(masses, mubarsq); }
+    else { return (-17*masses[0].p6 + 9*masses[0].p4*masses[1].sq + 9*masses[0].sq*masses[1].p4 - masses[1].p6 + 6*(masses[0].p6 + 3*masses[0].p4*masses[1].sq)*log(masses[0].sq/masses[1].sq))/(6*masses[0].p4*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf55(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf15(masses, mubarsq); }
+    else { return -0.08333333333333333*(3*masses[0].p8 - 16*masses[0].p6*masses[1].sq + 36*masses[0].p4*masses[1].p4 - 48*masses[0].sq*masses[1].p6 + 25*masses[1].p8 + 12*masses[1].p8*log(masses[0].sq/masses[1].sq))/pow(masses[0].sq - masses[1].sq,5); }
+}
+
+template <class T>
+static T lf56(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf16(masses, mubarsq); }
+    else { return (masses[0].p8 - 6*masses[0].p6*masses[1].sq + 18*masses[0].p4*masses[1].p4 - 10*masses[0].sq*masses[1].p6 - 3*masses[1].p8 - 12*masses[0].sq*masses[1].p6*log(masses[0].sq/masses[1].sq))/(12*masses[0].sq*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf57(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf17(masses, mubarsq); }
+    else { return (-masses[0].p8 + 8*masses[0].p6*masses[1].sq - 8*masses[0].sq*masses[1].p6 + masses[1].p8 - 12*masses[0].p4*masses[1].p4*log(masses[0].sq/masses[1].sq))/(12*masses[0].p4*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf58(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf18(masses, mubarsq); }
+    else { return -0.08333333333333333*(-3*masses[0].p8 - 10*masses[0].p6*masses[1].sq + 18*masses[0].p4*masses[1].p4 - 6*masses[0].sq*masses[1].p6 + masses[1].p8 + 12*masses[0].p6*masses[1].sq*log(masses[0].sq/masses[1].sq))/(masses[0].p6*pow(masses[0].sq - masses[1].sq,5)); }
+}
+
+template <class T>
+static T lf59(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf28(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf28(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf21(masses, mubarsq); }
+    else { return (masses[0].p4*(masses[1].sq - masses[2].sq)*masses[0].lg + masses[1].p4*(-masses[0].sq + masses[2].sq)*masses[1].lg + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) + masses[2].p4*masses[2].lg))/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf60(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf29(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf29(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf22(masses, mubarsq); }
+    else { return (masses[1].sq*(-masses[0].sq + masses[2].sq)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*masses[2].sq*log(masses[0].sq/masses[2].sq))/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf61(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf31(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf39(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf23(masses, mubarsq); }
+    else { return ((masses[1].p4*log(masses[0].sq/masses[1].sq))/(-masses[0].sq + masses[1].sq) + (masses[2].sq*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq) - (masses[1].sq*masses[2].sq + masses[0].sq*(-2*masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[2].sq)))/pow(masses[0].sq - masses[2].sq,2))/pow(masses[1].sq - masses[2].sq,2); }
+}
+
+template <class T>
+static T lf62(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf32(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf40(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf24(masses, mubarsq); }
+    else { return ((masses[1].sq*log(masses[0].sq/masses[1].sq))/(-masses[0].sq + masses[1].sq) + ((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq) + (masses[0].sq*masses[1].sq - masses[2].p4)*log(masses[0].sq/masses[2].sq))/pow(masses[0].sq - masses[2].sq,2))/pow(masses[1].sq - masses[2].sq,2); }
+}
+
+template <class T>
+static T lf63(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf34(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf49(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf25(masses, mubarsq); }
+    else { return ((2*masses[1].p4*log(masses[0].sq/masses[1].sq))/(-masses[0].sq + masses[1].sq) + (-((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[0].sq*(-3*masses[1].sq + masses[2].sq) + masses[2].sq*(masses[1].sq + masses[2].sq))) + 2*(masses[0].p4*masses[1].p4 + masses[1].sq*masses[2].p6 + masses[0].sq*(-3*masses[1].sq*masses[2].p4 + masses[2].p6))*log(masses[0].sq/masses[2].sq))/pow(masses[0].sq - masses[2].sq,3))/(2*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf64(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf35(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf50(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf26(masses, mubarsq); }
+    else { return (2*masses[1].sq*masses[2].sq*pow(-masses[0].sq + masses[2].sq,3)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[2].sq*(masses[1].sq - 3*masses[2].sq) + masses[0].sq*(masses[1].sq + masses[2].sq)) - 2*masses[2].sq*(masses[0].p4*masses[1].sq + masses[2].p6 + masses[0].sq*(masses[1].p4 - 3*masses[1].sq*masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(2*(masses[0].sq - masses[1].sq)*masses[2].sq*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf65(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf37(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf58(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf27(masses, mubarsq); }
+    else { return (-6*masses[1].sq*pow(-(masses[0].sq*masses[2].m) + pow(masses[2].m,3),4)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(2*masses[1].p4*masses[2].p4 - 7*masses[1].sq*masses[2].p6 + 11*masses[2].p8 + masses[0].p4*(-masses[1].p4 + 5*masses[1].sq*masses[2].sq + 2*masses[2].p4) + masses[0].sq*(5*masses[1].p4*masses[2].sq - 10*masses[1].sq*masses[2].p4 - 7*masses[2].p6)) + 6*masses[2].p4*(masses[0].p6*masses[1].sq - masses[2].p8 + masses[0].p4*(masses[1].p4 - 4*masses[1].sq*masses[2].sq) + masses[0].sq*(masses[1].p6 - 4*masses[1].p4*masses[2].sq + 6*masses[1].sq*masses[2].p4))*log(masses[0].sq/masses[2].sq)))/(6*(masses[0].sq - masses[1].sq)*masses[2].p4*pow(masses[0].sq - masses[2].sq,4)*pow(masses[1].sq - masses[2].sq,4)); }
+}
+
+template <class T>
+static T lf66(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf39(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf31(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf23(masses, mubarsq); }
+    else { return (masses[1].sq*(-2*masses[0].sq*masses[2].p4 + masses[1].sq*masses[2].p4 - masses[0].p4*(masses[1].sq - 2*masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*(masses[1].sq*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) + (-masses[0].sq + masses[1].sq)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf67(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf40(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf32(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf24(masses, mubarsq); }
+    else { return ((masses[0].sq - masses[2].sq)*(-masses[1].p4 + masses[0].sq*masses[2].sq)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) + (-masses[0].sq + masses[1].sq)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf68(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf42(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf42(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf25(masses, mubarsq); }
+    else { return (-(masses[1].sq*pow(masses[0].sq - masses[2].sq,2)*(masses[1].p4 - 2*masses[0].sq*masses[2].sq + masses[1].sq*masses[2].sq)*log(masses[0].sq/masses[1].sq)) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-2*masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq + masses[2].sq)) - (masses[0].sq - masses[1].sq)*masses[2].sq*(2*masses[0].sq*masses[1].sq - masses[2].sq*(masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf69(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf43(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf43(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf26(masses, mubarsq); }
+    else { return (pow(masses[0].sq - masses[2].sq,2)*(-2*masses[1].p4 + masses[0].sq*(masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(2*masses[0].sq - masses[1].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq) + (masses[0].sq - masses[1].sq)*(-2*masses[2].p4 + masses[0].sq*(masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf70(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf47(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf54(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf27(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,3)) + 1/(2*(masses[0].sq - masses[2].sq)*pow(-(masses[1].sq*masses[2].m) + pow(masses[2].m,3),2)) + log(masses[0].sq/masses[1].sq)/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,3)) - (masses[1].sq*(-3*masses[0].sq + 4*masses[1].sq - masses[2].sq)*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,4)) + ((2*masses[0].sq + masses[1].sq - 3*masses[2].sq)*log(masses[0].sq/masses[2].sq))/(pow(masses[0].sq - masses[2].sq,2)*pow(-masses[1].sq + masses[2].sq,3)) - (masses[2].sq*(3*masses[0].p4 + masses[1].p4 - 4*masses[1].sq*masses[2].sq + 6*masses[2].p4 + 2*masses[0].sq*(masses[1].sq - 4*masses[2].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,4)); }
+}
+
+template <class T>
+static T lf71(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf49(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf34(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf25(masses, mubarsq); }
+    else { return (-2*(masses[0].sq - masses[2].sq)*(masses[1].p6*masses[2].sq + masses[0].p4*masses[2].p4 + masses[0].sq*(masses[1].p6 - 3*masses[1].p4*masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[0].sq*(masses[1].sq - 3*masses[2].sq) + masses[1].sq*(masses[1].sq + masses[2].sq)) + 2*pow(masses[0].sq - masses[1].sq,2)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,3)*(masses[0].sq - masses[2].sq)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf72(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf50(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf35(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf26(masses, mubarsq); }
+    else { return (2*masses[1].sq*(masses[0].sq - masses[2].sq)*(masses[1].p6 - 3*masses[0].sq*masses[1].sq*masses[2].sq + masses[0].sq*masses[2].sq*(masses[0].sq + masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-3*masses[1].p4 + masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq + masses[2].sq)) - 2*masses[1].sq*pow(masses[0].sq - masses[1].sq,2)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(2*masses[1].sq*pow(-masses[0].sq + masses[1].sq,3)*(masses[0].sq - masses[2].sq)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf73(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf54(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf47(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf27(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)) + 1/(2*(masses[0].sq - masses[1].sq)*pow(pow(masses[1].m,3) - masses[1].m*masses[2].sq,2)) + ((2*masses[0].sq - 3*masses[1].sq + masses[2].sq)*log(masses[0].sq/masses[1].sq))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,3)) + (masses[1].sq*(3*masses[0].p4 + 6*masses[1].p4 - 4*masses[1].sq*masses[2].sq + masses[2].p4 + masses[0].sq*(-8*masses[1].sq + 2*masses[2].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(-masses[0].sq + masses[1].sq,3)*pow(masses[1].sq - masses[2].sq,4)) + log(masses[0].sq/masses[2].sq)/((-masses[0].sq + masses[2].sq)*pow(-masses[1].sq + masses[2].sq,3)) - (masses[2].sq*(-3*masses[0].sq - masses[1].sq + 4*masses[2].sq)*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,4)); }
+}
+
+template <class T>
+static T lf74(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf58(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf37(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf27(masses, mubarsq); }
+    else { return (6*masses[1].p4*(masses[0].sq - masses[2].sq)*(-masses[1].p8 + 6*masses[0].sq*masses[1].p4*masses[2].sq - 4*masses[0].sq*masses[1].sq*masses[2].sq*(masses[0].sq + masses[2].sq) + masses[0].sq*masses[2].sq*(masses[0].p4 + masses[0].sq*masses[2].sq + masses[2].p4))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(-11*masses[1].p8 + 7*masses[1].p6*masses[2].sq - 2*masses[1].p4*masses[2].p4 + masses[0].p4*(-2*masses[1].p4 - 5*masses[1].sq*masses[2].sq + masses[2].p4) + masses[0].sq*(7*masses[1].p6 + 10*masses[1].p4*masses[2].sq - 5*masses[1].sq*masses[2].p4)) + 6*masses[1].p4*pow(-masses[0].sq + masses[1].sq,3)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(6*masses[1].p4*pow(masses[0].sq - masses[1].sq,4)*(masses[0].sq - masses[2].sq)*pow(masses[1].sq - masses[2].sq,4)); }
+}
+
+template <class T>
+static T lf75(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf38(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf38(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf30(masses, mubarsq); }
+    else { return (masses[0].p4*(masses[1].sq - masses[2].sq)*(masses[0].p4 + 3*masses[1].sq*masses[2].sq - 2*masses[0].sq*(masses[1].sq + masses[2].sq))*masses[0].lg + masses[1].p6*pow(masses[0].sq - masses[2].sq,2)*masses[1].lg - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-(masses[1].sq*masses[2].sq) + masses[0].sq*(masses[1].sq + masses[2].sq)) + (masses[0].sq - masses[1].sq)*masses[2].p6*masses[2].lg))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf76(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf39(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf39(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf31(masses, mubarsq); }
+    else { return (masses[1].p4*pow(masses[0].sq - masses[2].sq,2)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*(masses[0].sq*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) + (masses[0].sq - masses[1].sq)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf77(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf40(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf40(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf32(masses, mubarsq); }
+    else { return (masses[1].sq*pow(masses[0].sq - masses[2].sq,2)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) + (masses[0].sq - masses[1].sq)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf78(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf41(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf48(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf33(masses, mubarsq); }
+    else { return (masses[1].p6*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[0].sq*masses[2].p4 - masses[1].sq*masses[2].p4 + masses[0].p4*(-masses[1].sq + masses[2].sq)) + (masses[0].sq - masses[1].sq)*masses[2].p4*(-(masses[1].sq*masses[2].sq) + masses[0].sq*(3*masses[1].sq - 2*masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf79(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf42(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf49(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf34(masses, mubarsq); }
+    else { return (masses[1].p4*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq - 2*masses[2].sq)) + (masses[0].sq - masses[1].sq)*masses[2].sq*(-masses[2].p4 + masses[0].sq*(2*masses[1].sq - masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf80(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf43(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf50(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf35(masses, mubarsq); }
+    else { return (masses[1].sq*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[0].sq - 2*masses[1].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq) + (masses[0].sq - masses[1].sq)*(masses[0].sq*masses[1].sq + masses[1].sq*masses[2].sq - 2*masses[2].p4)*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf81(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf47(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf58(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf37(masses, mubarsq); }
+    else { return (2*masses[1].sq*log(masses[0].sq/masses[1].sq) + ((masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-5*masses[1].p4*masses[2].sq + 9*masses[1].sq*masses[2].p4 - 2*masses[2].p6 + masses[0].p4*(masses[1].sq + masses[2].sq) - masses[0].sq*(masses[1].p4 - 2*masses[1].sq*masses[2].sq + 5*masses[2].p4)) - 2*(masses[0].sq - masses[1].sq)*masses[2].sq*(masses[0].p4*masses[1].sq + 2*masses[0].sq*(masses[1].p4 - 2*masses[1].sq*masses[2].sq) + masses[2].sq*(masses[1].p4 - 3*masses[1].sq*masses[2].sq + 3*masses[2].p4))*log(masses[0].sq/masses[2].sq)))/(masses[2].sq*pow(masses[0].sq - masses[2].sq,4)))/(2*pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf82(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf48(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf41(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf33(masses, mubarsq); }
+    else { return (masses[1].p4*pow(masses[0].sq - masses[2].sq,2)*(masses[1].sq*masses[2].sq + masses[0].sq*(2*masses[1].sq - 3*masses[2].sq))*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(-(masses[0].sq*masses[1].p4) + masses[1].p4*masses[2].sq + masses[0].p4*(-masses[1].sq + masses[2].sq)) - pow(masses[0].sq - masses[1].sq,2)*masses[2].p6*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf83(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf49(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf42(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf34(masses, mubarsq); }
+    else { return (masses[1].sq*pow(masses[0].sq - masses[2].sq,2)*(masses[1].p4 + masses[0].sq*(masses[1].sq - 2*masses[2].sq))*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[1].sq*masses[2].sq + masses[0].sq*(-2*masses[1].sq + masses[2].sq)) - pow(masses[0].sq - masses[1].sq,2)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf84(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf50(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf43(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf35(masses, mubarsq); }
+    else { return -((pow(masses[0].sq - masses[2].sq,2)*(-2*masses[1].p4 + masses[0].sq*masses[2].sq + masses[1].sq*masses[2].sq)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq + masses[1].sq - 2*masses[2].sq)*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq) - pow(masses[0].sq - masses[1].sq,2)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2))); }
+}
+
+template <class T>
+static T lf85(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf53(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf53(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf36(masses, mubarsq); }
+    else { return (2*masses[1].sq*pow(masses[0].sq - masses[2].sq,3)*(masses[1].p4 - masses[0].sq*masses[2].sq)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[0].p4*(masses[1].sq + masses[2].sq) + masses[1].sq*masses[2].sq*(masses[1].sq + masses[2].sq) + masses[0].sq*(masses[1].p4 - 6*masses[1].sq*masses[2].sq + masses[2].p4)) - 2*pow(masses[0].sq - masses[1].sq,2)*masses[2].sq*(masses[0].sq*masses[1].sq - masses[2].p4)*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf86(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf54(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf54(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf37(masses, mubarsq); }
+    else { return (-(pow(masses[0].sq - masses[2].sq,3)*(-3*masses[1].p4 + masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[1].sq)) + (masses[0].sq - masses[1].sq)*(2*(masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[0].p4 + masses[1].p4 - masses[1].sq*masses[2].sq + masses[2].p4 - masses[0].sq*(masses[1].sq + masses[2].sq)) + pow(masses[0].sq - masses[1].sq,2)*(masses[2].sq*(masses[1].sq - 3*masses[2].sq) + masses[0].sq*(masses[1].sq + masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf87(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf57(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf46(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf36(masses, mubarsq); }
+    else { return (2*pow(masses[0].sq - masses[2].sq,2)*(masses[1].p8 + masses[0].p4*masses[2].p4 + 2*masses[0].sq*masses[1].sq*(masses[1].p4 - 3*masses[1].sq*masses[2].sq + masses[2].p4))*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-3*masses[1].p4*masses[2].sq + masses[1].sq*masses[2].p4 + masses[0].p4*(masses[1].sq - 3*masses[2].sq) + masses[0].sq*(5*masses[1].p4 - 6*masses[1].sq*masses[2].sq + 5*masses[2].p4)) + 2*pow(masses[0].sq - masses[1].sq,3)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf88(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf58(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf47(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf37(masses, mubarsq); }
+    else { return (2*(3*masses[1].p6 - 3*masses[1].p4*masses[2].sq + masses[0].sq*masses[2].sq*(masses[0].sq + 2*masses[2].sq) + masses[1].sq*(-4*masses[0].sq*masses[2].sq + masses[2].p4))*log(masses[0].sq/masses[1].sq) + ((masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-2*masses[1].p6 + 9*masses[1].p4*masses[2].sq - 5*masses[1].sq*masses[2].p4 + masses[0].p4*(masses[1].sq + masses[2].sq) - masses[0].sq*(5*masses[1].p4 - 2*masses[1].sq*masses[2].sq + masses[2].p4)) + 2*masses[1].sq*pow(-masses[0].sq + masses[1].sq,3)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(masses[1].sq*pow(masses[0].sq - masses[2].sq,2)))/(2*pow(masses[0].sq - masses[1].sq,4)*pow(masses[1].sq - masses[2].sq,3)); }
+}
+
+template <class T>
+static T lf89(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf48(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf48(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf41(masses, mubarsq); }
+    else { return -0.5*(2*masses[1].p6*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*(masses[0].sq*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[0].p4 + 5*masses[1].sq*masses[2].sq - 3*masses[0].sq*(masses[1].sq + masses[2].sq)) - 2*pow(masses[0].sq - masses[1].sq,2)*masses[2].p6*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf90(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf49(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf49(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf42(masses, mubarsq); }
+    else { return (-2*masses[1].p4*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[0].p4 - 3*masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq + masses[2].sq)) + 2*pow(masses[0].sq - masses[1].sq,2)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf91(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf50(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf50(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf43(masses, mubarsq); }
+    else { return (-2*masses[0].sq*masses[1].sq*pow(masses[0].sq - masses[2].sq,3)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(3*masses[0].p4 - masses[1].sq*masses[2].sq - masses[0].sq*(masses[1].sq + masses[2].sq)) + 2*masses[0].sq*pow(masses[0].sq - masses[1].sq,2)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(2*masses[0].sq*pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf92(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf53(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf57(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf46(masses, mubarsq); }
+    else { return (-2*masses[1].p4*pow(masses[0].sq - masses[2].sq,4)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(5*masses[1].p4*masses[2].sq - 3*masses[1].sq*masses[2].p4 + masses[0].p4*(-3*masses[1].sq + 5*masses[2].sq) + masses[0].sq*(masses[1].p4 - 6*masses[1].sq*masses[2].sq + masses[2].p4)) + 2*pow(masses[0].sq - masses[1].sq,2)*masses[2].sq*(masses[2].sq*(masses[1].sq - 2*masses[2].sq) + masses[0].sq*(2*masses[1].sq - masses[2].sq))*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,4)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf93(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf54(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf58(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf47(masses, mubarsq); }
+    else { return (-2*masses[0].sq*masses[1].sq*pow(masses[0].sq - masses[2].sq,4)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(2*masses[0].p6 + masses[1].sq*masses[2].sq*(masses[1].sq - masses[2].sq) + masses[0].p4*(-9*masses[1].sq + 5*masses[2].sq) + masses[0].sq*(5*masses[1].p4 - 2*masses[1].sq*masses[2].sq - masses[2].p4)) + 2*pow(pow(masses[0].m,3) - masses[0].m*masses[1].sq,2)*(masses[0].sq*masses[1].sq + 2*masses[1].sq*masses[2].sq - 3*masses[2].p4)*log(masses[0].sq/masses[2].sq)))/(2*masses[0].sq*pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,4)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf94(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf55(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf51(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf44(masses, mubarsq); }
+    else { return -0.5*(2*masses[1].p6*pow(masses[0].sq - masses[2].sq,3)*(masses[1].sq*masses[2].sq + masses[0].sq*(3*masses[1].sq - 4*masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(-4*masses[0].sq*masses[1].p6*masses[2].sq + 2*masses[1].p6*masses[2].p4 + masses[0].p8*(-masses[1].sq + masses[2].sq) + masses[0].p6*(5*masses[1].p4 - 2*masses[1].sq*masses[2].sq - 3*masses[2].p4) + masses[0].p4*(2*masses[1].p6 - 7*masses[1].p4*masses[2].sq + 7*masses[1].sq*masses[2].p4)) + 2*pow(masses[0].sq - masses[1].sq,3)*masses[2].p8*log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf95(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf56(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf52(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf45(masses, mubarsq); }
+    else { return (-2*masses[1].p4*pow(masses[0].sq - masses[2].sq,3)*(masses[1].p4 + masses[0].sq*(2*masses[1].sq - 3*masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(-masses[1].sq + masses[2].sq)*(-2*masses[1].p4*masses[2].p4 + masses[0].p6*(-masses[1].sq + masses[2].sq) + masses[0].p4*(-5*masses[1].p4 + 2*masses[1].sq*masses[2].sq + masses[2].p4) + masses[0].sq*(9*masses[1].p4*masses[2].sq - 5*masses[1].sq*masses[2].p4)) - 2*pow(masses[0].sq - masses[1].sq,3)*masses[2].p6*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf96(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf57(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf53(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf46(masses, mubarsq); }
+    else { return (-2*masses[1].sq*pow(masses[0].sq - masses[2].sq,3)*(2*masses[1].p4 - masses[1].sq*masses[2].sq + masses[0].sq*(masses[1].sq - 2*masses[2].sq))*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(-3*masses[1].p4*masses[2].sq + 5*masses[1].sq*masses[2].p4 + masses[0].p4*(5*masses[1].sq - 3*masses[2].sq) + masses[0].sq*(masses[1].p4 - 6*masses[1].sq*masses[2].sq + masses[2].p4)) - 2*pow(masses[0].sq - masses[1].sq,3)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(2*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf97(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf58(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf54(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf47(masses, mubarsq); }
+    else { return (2*(-3*masses[1].p4 + masses[0].sq*masses[2].sq + 2*masses[1].sq*masses[2].sq)*log(masses[0].sq/masses[1].sq) + ((masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(2*masses[0].p6 - masses[1].p4*masses[2].sq + masses[1].sq*masses[2].p4 + masses[0].p4*(5*masses[1].sq - 9*masses[2].sq) - masses[0].sq*(masses[1].p4 + 2*masses[1].sq*masses[2].sq - 5*masses[2].p4)) - 2*masses[0].sq*pow(masses[0].sq - masses[1].sq,3)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(masses[0].sq*pow(masses[0].sq - masses[2].sq,3)))/(2*pow(masses[0].sq - masses[1].sq,4)*pow(masses[1].sq - masses[2].sq,2)); }
+}
+
+template <class T>
+static T lf98(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf55(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf55(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf51(masses, mubarsq); }
+    else { return (6*masses[1].p8*pow(masses[0].sq - masses[2].sq,4)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*(masses[0].sq*(masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(2*masses[0].p8 + 26*masses[1].p4*masses[2].p4 - 7*masses[0].p6*(masses[1].sq + masses[2].sq) - 31*masses[0].sq*masses[1].sq*masses[2].sq*(masses[1].sq + masses[2].sq) + masses[0].p4*(11*masses[1].p4 + 26*masses[1].sq*masses[2].sq + 11*masses[2].p4)) + 6*pow(masses[0].sq - masses[1].sq,3)*masses[2].p8*log(masses[0].sq/masses[2].sq)))/(6*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,4)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf99(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf56(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf56(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf52(masses, mubarsq); }
+    else { return (6*masses[1].p6*pow(masses[0].sq - masses[2].sq,4)*log(masses[0].sq/masses[1].sq) + (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(masses[0].p8 - 11*masses[1].p4*masses[2].p4 - 5*masses[0].p6*(masses[1].sq + masses[2].sq) + 7*masses[0].sq*masses[1].sq*masses[2].sq*(masses[1].sq + masses[2].sq) - 2*masses[0].p4*(masses[1].p4 - 5*masses[1].sq*masses[2].sq + masses[2].p4)) - 6*pow(masses[0].sq - masses[1].sq,3)*masses[2].p6*log(masses[0].sq/masses[2].sq)))/(6*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,4)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf100(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf57(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf57(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf53(masses, mubarsq); }
+    else { return (6*masses[1].p4*log(masses[0].sq/masses[1].sq) - ((masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(2*masses[0].p8 + 2*masses[1].p4*masses[2].p4 + 5*masses[0].p6*(masses[1].sq + masses[2].sq) + 5*masses[0].sq*masses[1].sq*masses[2].sq*(masses[1].sq + masses[2].sq) - masses[0].p4*(masses[1].p4 + 22*masses[1].sq*masses[2].sq + masses[2].p4)) + 6*masses[0].sq*pow(masses[0].sq - masses[1].sq,3)*masses[2].p4*log(masses[0].sq/masses[2].sq)))/(masses[0].sq*pow(masses[0].sq - masses[2].sq,4)))/(6*pow(masses[0].sq - masses[1].sq,4)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf101(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf58(std::array{masses[0], masses[2]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf58(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf54(masses, mubarsq); }
+    else { return (6*masses[1].sq*pow(pow(masses[0].m,3) - masses[0].m*masses[2].sq,4)*log(masses[0].sq/masses[1].sq) - (masses[0].sq - masses[1].sq)*((masses[0].sq - masses[2].sq)*(masses[1].sq - masses[2].sq)*(11*masses[0].p8 - masses[1].p4*masses[2].p4 - 7*masses[0].p6*(masses[1].sq + masses[2].sq) + 5*masses[0].sq*masses[1].sq*masses[2].sq*(masses[1].sq + masses[2].sq) + 2*masses[0].p4*(masses[1].p4 - 5*masses[1].sq*masses[2].sq + masses[2].p4)) + 6*masses[0].p4*pow(masses[0].sq - masses[1].sq,3)*masses[2].sq*log(masses[0].sq/masses[2].sq)))/(6*masses[0].p4*pow(masses[0].sq - masses[1].sq,4)*pow(masses[0].sq - masses[2].sq,4)*(masses[1].sq - masses[2].sq)); }
+}
+
+template <class T>
+static T lf102(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf76(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf76(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf76(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf66(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf66(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf61(masses, mubarsq); }
+    else { return ((masses[1].p4*log(masses[0].sq/masses[1].sq))/(-masses[0].sq + masses[1].sq) + ((masses[2].p4*(masses[1].sq - masses[3].sq)*log(masses[0].sq/masses[2].sq))/(masses[0].sq - masses[2].sq) + ((masses[1].sq - masses[2].sq)*masses[3].p4*log(masses[0].sq/masses[3].sq))/(-masses[0].sq + masses[3].sq))/(masses[2].sq - masses[3].sq))/((masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)); }
+}
+
+template <class T>
+static T lf103(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf77(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf77(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf77(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf67(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf67(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf62(masses, mubarsq); }
+    else { return ((masses[1].sq*log(masses[0].sq/masses[1].sq))/(-masses[0].sq + masses[1].sq) + ((masses[2].sq*(masses[1].sq - masses[3].sq)*log(masses[0].sq/masses[2].sq))/(masses[0].sq - masses[2].sq) + ((masses[1].sq - masses[2].sq)*masses[3].sq*log(masses[0].sq/masses[3].sq))/(-masses[0].sq + masses[3].sq))/(masses[2].sq - masses[3].sq))/((masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)); }
+}
+
+template <class T>
+static T lf104(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf79(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf79(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf90(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf68(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf71(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf63(masses, mubarsq); }
+    else { return masses[0].p4/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].p4*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,2)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)) - (masses[3].p4*(-2*masses[2].sq*masses[3].sq + 3*masses[3].p4 + masses[1].sq*(masses[2].sq - 2*masses[3].sq) + masses[0].sq*(masses[1].sq + masses[2].sq - 2*masses[3].sq))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)) + (masses[3].sq*(1 + 2*log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf105(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf80(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf80(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf91(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf69(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf72(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf64(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)) + log(masses[0].sq/masses[3].sq)/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)) - (masses[3].sq*(-2*masses[2].sq*masses[3].sq + 3*masses[3].p4 + masses[1].sq*(masses[2].sq - 2*masses[3].sq) + masses[0].sq*(masses[1].sq + masses[2].sq - 2*masses[3].sq))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)); }
+}
+
+template <class T>
+static T lf106(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf81(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf81(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf101(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf70(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf74(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf65(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*pow(masses[0].sq - masses[3].sq,3)) - 1/(2*masses[3].sq*(-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,3)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,3)) - ((-2*masses[2].sq*masses[3].sq + 3*masses[3].p4 + masses[1].sq*(masses[2].sq - 2*masses[3].sq) + masses[0].sq*(masses[1].sq + masses[2].sq - 2*masses[3].sq))*log(masses[0].sq/masses[3].sq))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)) - (masses[3].sq*(3*masses[2].p4*masses[3].p4 - 8*masses[2].sq*masses[3].p6 + 6*masses[3].p8 + masses[1].p4*(masses[2].p4 - 3*masses[2].sq*masses[3].sq + 3*masses[3].p4) + masses[1].sq*(-3*masses[2].p4*masses[3].sq + 9*masses[2].sq*masses[3].p4 - 8*masses[3].p6) + masses[0].p4*(masses[1].p4 + masses[2].p4 - 3*masses[2].sq*masses[3].sq + 3*masses[3].p4 + masses[1].sq*(masses[2].sq - 3*masses[3].sq)) + masses[0].sq*(-3*masses[2].p4*masses[3].sq + 9*masses[2].sq*masses[3].p4 - 8*masses[3].p6 + masses[1].p4*(masses[2].sq - 3*masses[3].sq) + masses[1].sq*pow(masses[2].sq - 3*masses[3].sq,2)))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,3)*pow(-masses[1].sq + masses[3].sq,3)*pow(-masses[2].sq + masses[3].sq,3)); }
+}
+
+template <class T>
+static T lf107(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf83(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf90(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf79(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf71(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf68(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf63(masses, mubarsq); }
+    else { return masses[0].p4/((masses[0].sq - masses[1].sq)*pow(masses[0].sq - masses[2].sq,2)*(masses[0].sq - masses[3].sq)) + (masses[1].p4*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,2)*(masses[1].sq - masses[3].sq)) - (masses[2].p4*(3*masses[2].p4 - 2*masses[2].sq*masses[3].sq + masses[1].sq*(-2*masses[2].sq + masses[3].sq) + masses[0].sq*(masses[1].sq - 2*masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,2)) + (masses[2].sq*(1 + 2*log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[2].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf108(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf84(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf91(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf80(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf72(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf69(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf64(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*pow(masses[0].sq - masses[2].sq,2)*(masses[0].sq - masses[3].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,2)*(masses[1].sq - masses[3].sq)) + log(masses[0].sq/masses[2].sq)/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) - (masses[2].sq*(3*masses[2].p4 - 2*masses[2].sq*masses[3].sq + masses[1].sq*(-2*masses[2].sq + masses[3].sq) + masses[0].sq*(masses[1].sq - 2*masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,2)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[2].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf109(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf86(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf93(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf93(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf73(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf73(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf65(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) + log(masses[0].sq/masses[2].sq)/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)) - (masses[2].sq*(4*masses[2].p4 - 2*masses[2].sq*masses[3].sq + masses[1].sq*(-3*masses[2].sq + masses[3].sq) + masses[0].sq*(2*masses[1].sq - 3*masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,3)) + log(masses[0].sq/masses[3].sq)/(pow(masses[2].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)) - (masses[3].sq*(-2*masses[2].sq*masses[3].sq + 4*masses[3].p4 + masses[1].sq*(masses[2].sq - 3*masses[3].sq) + masses[0].sq*(2*masses[1].sq + masses[2].sq - 3*masses[3].sq))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(-masses[2].sq + masses[3].sq,3)); }
+}
+
+template <class T>
+static T lf110(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf88(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf101(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf81(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf74(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf70(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf65(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*pow(masses[0].sq - masses[2].sq,3)*(masses[0].sq - masses[3].sq)) - 1/(2*masses[2].sq*(-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,3)*(masses[1].sq - masses[3].sq)) - ((3*masses[2].p4 - 2*masses[2].sq*masses[3].sq + masses[1].sq*(-2*masses[2].sq + masses[3].sq) + masses[0].sq*(masses[1].sq - 2*masses[2].sq + masses[3].sq))*log(masses[0].sq/masses[2].sq))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,2)) - (masses[2].sq*(6*masses[2].p8 - 8*masses[2].p6*masses[3].sq + 3*masses[2].p4*masses[3].p4 + masses[1].p4*(3*masses[2].p4 - 3*masses[2].sq*masses[3].sq + masses[3].p4) + masses[1].sq*(-8*masses[2].p6 + 9*masses[2].p4*masses[3].sq - 3*masses[2].sq*masses[3].p4) + masses[0].p4*(masses[1].p4 + 3*masses[2].p4 - 3*masses[2].sq*masses[3].sq + masses[3].p4 + masses[1].sq*(-3*masses[2].sq + masses[3].sq)) + masses[0].sq*(-8*masses[2].p6 + 9*masses[2].p4*masses[3].sq - 3*masses[2].sq*masses[3].p4 + masses[1].p4*(-3*masses[2].sq + masses[3].sq) + masses[1].sq*pow(-3*masses[2].sq + masses[3].sq,2)))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,3)*pow(-masses[1].sq + masses[2].sq,3)*pow(masses[2].sq - masses[3].sq,3)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*pow(-masses[2].sq + masses[3].sq,3)); }
+}
+
+template <class T>
+static T lf111(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf90(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf83(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf83(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf71(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf71(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf68(masses, mubarsq); }
+    else { return masses[0].p4/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - (masses[1].p4*(3*masses[1].p4 + masses[2].sq*masses[3].sq - 2*masses[1].sq*(masses[2].sq + masses[3].sq) + masses[0].sq*(-2*masses[1].sq + masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) + (masses[1].sq*(1 + 2*log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[1].sq - masses[2].sq,2)*(-masses[0].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[1].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf112(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf91(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf84(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf84(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf72(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf72(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf69(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) + log(masses[0].sq/masses[1].sq)/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) - (masses[1].sq*(3*masses[1].p4 + masses[2].sq*masses[3].sq - 2*masses[1].sq*(masses[2].sq + masses[3].sq) + masses[0].sq*(-2*masses[1].sq + masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[1].sq - masses[2].sq,2)*(-masses[0].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[1].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf113(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf93(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf86(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf97(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf73(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf74(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf70(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*pow(masses[0].sq - masses[3].sq,2)) + log(masses[0].sq/masses[1].sq)/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,2)) - (masses[1].sq*(4*masses[1].p4 + masses[2].sq*masses[3].sq + masses[0].sq*(-3*masses[1].sq + 2*masses[2].sq + masses[3].sq) - masses[1].sq*(3*masses[2].sq + 2*masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,3)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[1].sq - masses[2].sq,2)*(-masses[0].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)) + log(masses[0].sq/masses[3].sq)/(pow(masses[1].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)) - (masses[3].sq*(-3*masses[2].sq*masses[3].sq + 4*masses[3].p4 + masses[0].sq*(masses[1].sq + 2*masses[2].sq - 3*masses[3].sq) + masses[1].sq*(masses[2].sq - 2*masses[3].sq))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)*pow(-masses[1].sq + masses[3].sq,3)); }
+}
+
+template <class T>
+static T lf114(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf97(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf97(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf86(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf74(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf73(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf70(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*(masses[0].sq - masses[3].sq)) + log(masses[0].sq/masses[1].sq)/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,2)*(masses[1].sq - masses[3].sq)) - (masses[1].sq*(4*masses[1].p4 + masses[2].sq*masses[3].sq + masses[0].sq*(-3*masses[1].sq + masses[2].sq + 2*masses[3].sq) - masses[1].sq*(2*masses[2].sq + 3*masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,3)*pow(masses[1].sq - masses[3].sq,2)) + log(masses[0].sq/masses[2].sq)/(pow(masses[1].sq - masses[2].sq,2)*(-masses[0].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) - (masses[2].sq*(4*masses[2].p4 - 3*masses[2].sq*masses[3].sq + masses[1].sq*(-2*masses[2].sq + masses[3].sq) + masses[0].sq*(masses[1].sq - 3*masses[2].sq + 2*masses[3].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(-masses[1].sq + masses[2].sq,3)*pow(masses[2].sq - masses[3].sq,2)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf115(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf101(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf88(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf88(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf74(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf74(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf73(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,3)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - 1/(2*masses[1].sq*(-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + ((-3*masses[1].p4 - masses[2].sq*masses[3].sq + masses[0].sq*(2*masses[1].sq - masses[2].sq - masses[3].sq) + 2*masses[1].sq*(masses[2].sq + masses[3].sq))*log(masses[0].sq/masses[1].sq))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) - (masses[1].sq*(6*masses[1].p8 + masses[2].p4*masses[3].p4 - 8*masses[1].p6*(masses[2].sq + masses[3].sq) - 3*masses[1].sq*masses[2].sq*masses[3].sq*(masses[2].sq + masses[3].sq) + 3*masses[1].p4*(masses[2].p4 + 3*masses[2].sq*masses[3].sq + masses[3].p4) + masses[0].p4*(3*masses[1].p4 + masses[2].p4 + masses[2].sq*masses[3].sq + masses[3].p4 - 3*masses[1].sq*(masses[2].sq + masses[3].sq)) + masses[0].sq*(-8*masses[1].p6 + 9*masses[1].p4*(masses[2].sq + masses[3].sq) + masses[2].sq*masses[3].sq*(masses[2].sq + masses[3].sq) - 3*masses[1].sq*pow(masses[2].sq + masses[3].sq,2)))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[1].sq - masses[2].sq,3)*pow(masses[1].sq - masses[3].sq,3)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*pow(-masses[1].sq + masses[2].sq,3)*(masses[2].sq - masses[3].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*pow(-masses[1].sq + masses[3].sq,3)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf116(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf89(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf89(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf89(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf82(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf82(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf78(masses, mubarsq); }
+    else { return (2*masses[0].p4)/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - (masses[0].p6*(3*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - 2*masses[0].sq*(masses[1].sq + masses[2].sq + masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].p6*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].p6*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].p6*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf117(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf90(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf90(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf90(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf83(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf83(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf79(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - (masses[0].p4*(3*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - 2*masses[0].sq*(masses[1].sq + masses[2].sq + masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].p4*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf118(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf91(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf91(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf91(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf84(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf84(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf80(masses, mubarsq); }
+    else { return -((masses[0].sq*(3*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - 2*masses[0].sq*(masses[1].sq + masses[2].sq + masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2))) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf119(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf93(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf93(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf101(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf86(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf88(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf81(masses, mubarsq); }
+    else { return -((masses[0].sq*(4*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(2*masses[2].sq + masses[3].sq) - masses[0].sq*(3*masses[1].sq + 3*masses[2].sq + 2*masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,3))) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)) + log(masses[0].sq/masses[3].sq)/(pow(masses[0].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)) + (masses[3].sq*(-3*masses[2].sq*masses[3].sq + 4*masses[3].p4 + masses[1].sq*(2*masses[2].sq - 3*masses[3].sq) + masses[0].sq*(masses[1].sq + masses[2].sq - 2*masses[3].sq))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,3)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)); }
+}
+
+template <class T>
+static T lf120(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf97(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf101(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf93(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf88(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf86(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf81(masses, mubarsq); }
+    else { return -((masses[0].sq*(4*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + 2*masses[3].sq) - masses[0].sq*(3*masses[1].sq + 2*masses[2].sq + 3*masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[0].sq - masses[3].sq,2))) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*(masses[1].sq - masses[3].sq)) + log(masses[0].sq/masses[2].sq)/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[2].sq*(4*masses[2].p4 - 3*masses[2].sq*masses[3].sq + masses[0].sq*(masses[1].sq - 2*masses[2].sq + masses[3].sq) + masses[1].sq*(-3*masses[2].sq + 2*masses[3].sq))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,3)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,2)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf121(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf100(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf96(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf96(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf87(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf87(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf85(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - (masses[0].p4*(4*masses[0].p4 + 2*masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - masses[0].sq*(2*masses[1].sq + 3*(masses[2].sq + masses[3].sq))))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)) + (masses[1].p4*(4*masses[1].p4 + 2*masses[2].sq*masses[3].sq - 3*masses[1].sq*(masses[2].sq + masses[3].sq) + masses[0].sq*(-2*masses[1].sq + masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) + (masses[1].sq*(1 + 2*log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*(masses[2].sq - masses[3].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf122(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf101(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf97(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf97(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf88(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf88(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf86(masses, mubarsq); }
+    else { return -((masses[0].sq*(4*masses[0].p4 + 2*masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - masses[0].sq*(2*masses[1].sq + 3*(masses[2].sq + masses[3].sq))))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2))) + log(masses[0].sq/masses[1].sq)/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[1].sq*(4*masses[1].p4 + 2*masses[2].sq*masses[3].sq - 3*masses[1].sq*(masses[2].sq + masses[3].sq) + masses[0].sq*(-2*masses[1].sq + masses[2].sq + masses[3].sq))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*(masses[2].sq - masses[3].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf123(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf100(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf100(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf100(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf96(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf96(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf92(masses, mubarsq); }
+    else { return -0.5*1/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) - (masses[0].sq*(3*masses[0].p4 + masses[2].sq*masses[3].sq + masses[1].sq*(masses[2].sq + masses[3].sq) - 2*masses[0].sq*(masses[1].sq + masses[2].sq + masses[3].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)) + (masses[0].p4*(6*masses[0].p8 + masses[2].p4*masses[3].p4 + masses[1].sq*masses[2].sq*masses[3].sq*(masses[2].sq + masses[3].sq) - 3*masses[0].sq*(masses[1].sq + masses[2].sq)*(masses[1].sq + masses[3].sq)*(masses[2].sq + masses[3].sq) - 8*masses[0].p6*(masses[1].sq + masses[2].sq + masses[3].sq) + masses[1].p4*(masses[2].p4 + masses[2].sq*masses[3].sq + masses[3].p4) + 3*masses[0].p4*(masses[1].p4 + masses[2].p4 + 3*masses[2].sq*masses[3].sq + masses[3].p4 + 3*masses[1].sq*(masses[2].sq + masses[3].sq))))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[0].sq - masses[3].sq,3)) + (masses[1].p4*(1 + log(masses[0].sq/masses[1].sq)))/(pow(-masses[0].sq + masses[1].sq,3)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/(pow(-masses[0].sq + masses[2].sq,3)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/(pow(-masses[0].sq + masses[3].sq,3)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf124(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf101(std::array{masses[0], masses[2], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf101(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf101(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf97(std::array{masses[0], masses[1], masses[3]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf97(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf93(masses, mubarsq); }
+    else { return -0.5*1/(masses[0].sq*(masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)) + (masses[0].sq*(6*masses[0].p8 + masses[2].p4*masses[3].p4 + masses[1].sq*masses[2].sq*masses[3].sq*(masses[2].sq + masses[3].sq) - 3*masses[0].sq*(masses[1].sq + masses[2].sq)*(masses[1].sq + masses[3].sq)*(masses[2].sq + masses[3].sq) - 8*masses[0].p6*(masses[1].sq + masses[2].sq + masses[3].sq) + masses[1].p4*(masses[2].p4 + masses[2].sq*masses[3].sq + masses[3].p4) + 3*masses[0].p4*(masses[1].p4 + masses[2].p4 + 3*masses[2].sq*masses[3].sq + masses[3].p4 + 3*masses[1].sq*(masses[2].sq + masses[3].sq))))/(pow(masses[0].sq - masses[1].sq,3)*pow(masses[0].sq - masses[2].sq,3)*pow(masses[0].sq - masses[3].sq,3)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/(pow(-masses[0].sq + masses[1].sq,3)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(-masses[0].sq + masses[2].sq,3)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(-masses[0].sq + masses[3].sq,3)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)); }
+}
+
+template <class T>
+static T lf125(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf117(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf117(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf117(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf117(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf111(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf111(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf111(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf107(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf107(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf104(masses, mubarsq); }
+    else { return masses[0].p4/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)*(masses[0].sq - masses[4].sq)) + (masses[1].p4*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)) + (masses[2].p4*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)) + (masses[3].p4*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) + (masses[4].p4*(1 + log(masses[0].sq/masses[4].sq)))/((-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf126(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf118(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf118(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf118(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf118(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf112(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf112(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf112(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf108(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf108(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf105(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)*(masses[0].sq - masses[4].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/((-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf127(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf119(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf119(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf119(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf124(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf113(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf113(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf115(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf109(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf110(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf106(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)*pow(masses[0].sq - masses[4].sq,2)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*pow(masses[1].sq - masses[4].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*pow(masses[2].sq - masses[4].sq,2)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*pow(masses[3].sq - masses[4].sq,2)) + log(masses[0].sq/masses[4].sq)/((-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)) - (masses[4].sq*(2*masses[2].sq*masses[3].sq*masses[4].sq - 3*masses[2].sq*masses[4].p4 - 3*masses[3].sq*masses[4].p4 + 4*masses[4].p6 + masses[1].sq*(2*masses[3].sq*masses[4].sq - 3*masses[4].p4 - masses[2].sq*(masses[3].sq - 2*masses[4].sq)) - masses[0].sq*(-2*masses[3].sq*masses[4].sq + 3*masses[4].p4 + masses[2].sq*(masses[3].sq - 2*masses[4].sq) + masses[1].sq*(masses[2].sq + masses[3].sq - 2*masses[4].sq)))*(1 + log(masses[0].sq/masses[4].sq)))/(pow(masses[0].sq - masses[4].sq,2)*pow(masses[1].sq - masses[4].sq,2)*pow(masses[2].sq - masses[4].sq,2)*pow(masses[3].sq - masses[4].sq,2)); }
+}
+
+template <class T>
+static T lf128(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf120(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf120(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf124(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf119(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf114(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf115(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf113(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf110(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf109(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf106(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*pow(masses[0].sq - masses[3].sq,2)*(masses[0].sq - masses[4].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*pow(masses[1].sq - masses[3].sq,2)*(masses[1].sq - masses[4].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*pow(masses[2].sq - masses[3].sq,2)*(masses[2].sq - masses[4].sq)) + log(masses[0].sq/masses[3].sq)/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) - (masses[3].sq*(-3*masses[2].sq*masses[3].p4 + 4*masses[3].p6 + 2*masses[2].sq*masses[3].sq*masses[4].sq - 3*masses[3].p4*masses[4].sq + masses[1].sq*(-3*masses[3].p4 + 2*masses[3].sq*masses[4].sq + masses[2].sq*(2*masses[3].sq - masses[4].sq)) - masses[0].sq*(3*masses[3].p4 - 2*masses[3].sq*masses[4].sq + masses[2].sq*(-2*masses[3].sq + masses[4].sq) + masses[1].sq*(masses[2].sq - 2*masses[3].sq + masses[4].sq)))*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[2].sq - masses[3].sq,2)*pow(masses[3].sq - masses[4].sq,2)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/(pow(masses[3].sq - masses[4].sq,2)*(-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf129(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf122(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf124(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf120(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf120(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf115(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf114(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf114(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf110(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf110(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf109(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*pow(masses[0].sq - masses[2].sq,2)*(masses[0].sq - masses[3].sq)*(masses[0].sq - masses[4].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*pow(masses[1].sq - masses[2].sq,2)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)) + log(masses[0].sq/masses[2].sq)/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)) - (masses[2].sq*(4*masses[2].p6 - 3*masses[2].p4*masses[3].sq - 3*masses[2].p4*masses[4].sq + 2*masses[2].sq*masses[3].sq*masses[4].sq + masses[1].sq*(-3*masses[2].p4 - masses[3].sq*masses[4].sq + 2*masses[2].sq*(masses[3].sq + masses[4].sq)) + masses[0].sq*(-3*masses[2].p4 - masses[3].sq*masses[4].sq + masses[1].sq*(2*masses[2].sq - masses[3].sq - masses[4].sq) + 2*masses[2].sq*(masses[3].sq + masses[4].sq)))*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[2].sq - masses[3].sq,2)*pow(masses[2].sq - masses[4].sq,2)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[2].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/(pow(masses[2].sq - masses[4].sq,2)*(-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf130(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf124(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf122(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf122(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf122(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf115(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf115(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf115(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf114(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf114(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf113(masses, mubarsq); }
+    else { return masses[0].sq/(pow(masses[0].sq - masses[1].sq,2)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)*(masses[0].sq - masses[4].sq)) + log(masses[0].sq/masses[1].sq)/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)) - (masses[1].sq*(4*masses[1].p6 - masses[2].sq*masses[3].sq*masses[4].sq - 3*masses[1].p4*(masses[2].sq + masses[3].sq + masses[4].sq) + 2*masses[1].sq*(masses[3].sq*masses[4].sq + masses[2].sq*(masses[3].sq + masses[4].sq)) - masses[0].sq*(3*masses[1].p4 + masses[3].sq*masses[4].sq + masses[2].sq*(masses[3].sq + masses[4].sq) - 2*masses[1].sq*(masses[2].sq + masses[3].sq + masses[4].sq)))*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[1].sq - masses[2].sq,2)*pow(masses[1].sq - masses[3].sq,2)*pow(masses[1].sq - masses[4].sq,2)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[1].sq - masses[2].sq,2)*(-masses[0].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[1].sq - masses[3].sq,2)*(-masses[0].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/(pow(masses[1].sq - masses[4].sq,2)*(-masses[0].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf131(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf124(std::array{masses[0], masses[2], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf124(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf124(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf124(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf122(std::array{masses[0], masses[1], masses[3], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf122(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf122(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf120(std::array{masses[0], masses[1], masses[2], masses[4]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf120(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf119(masses, mubarsq); }
+    else { return (masses[0].sq*(-4*masses[0].p6 + masses[2].sq*masses[3].sq*masses[4].sq + 3*masses[0].p4*(masses[1].sq + masses[2].sq + masses[3].sq + masses[4].sq) + masses[1].sq*(masses[3].sq*masses[4].sq + masses[2].sq*(masses[3].sq + masses[4].sq)) - 2*masses[0].sq*(masses[3].sq*masses[4].sq + masses[2].sq*(masses[3].sq + masses[4].sq) + masses[1].sq*(masses[2].sq + masses[3].sq + masses[4].sq))))/(pow(masses[0].sq - masses[1].sq,2)*pow(masses[0].sq - masses[2].sq,2)*pow(masses[0].sq - masses[3].sq,2)*pow(masses[0].sq - masses[4].sq,2)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/(pow(masses[0].sq - masses[1].sq,2)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/(pow(masses[0].sq - masses[2].sq,2)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/(pow(masses[0].sq - masses[3].sq,2)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/(pow(masses[0].sq - masses[4].sq,2)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)); }
+}
+
+template <class T>
+static T lf132(const BasicLFMass<T>* masses, double mubarsq) {
+    if (masses[0].m == masses[1].m) { return lf131(std::array{masses[0], masses[2], masses[3], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[0].m == masses[2].m) { return lf131(std::array{masses[0], masses[1], masses[3], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[0].m == masses[3].m) { return lf131(std::array{masses[0], masses[1], masses[2], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[0].m == masses[4].m) { return lf131(std::array{masses[0], masses[1], masses[2], masses[3], masses[5]}.data(), mubarsq); }
+    else if (masses[0].m == masses[5].m) { return lf131(masses, mubarsq); }
+    else if (masses[1].m == masses[2].m) { return lf130(std::array{masses[0], masses[1], masses[3], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[1].m == masses[3].m) { return lf130(std::array{masses[0], masses[1], masses[2], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[1].m == masses[4].m) { return lf130(std::array{masses[0], masses[1], masses[2], masses[3], masses[5]}.data(), mubarsq); }
+    else if (masses[1].m == masses[5].m) { return lf130(masses, mubarsq); }
+    else if (masses[2].m == masses[3].m) { return lf129(std::array{masses[0], masses[1], masses[2], masses[4], masses[5]}.data(), mubarsq); }
+    else if (masses[2].m == masses[4].m) { return lf129(std::array{masses[0], masses[1], masses[2], masses[3], masses[5]}.data(), mubarsq); }
+    else if (masses[2].m == masses[5].m) { return lf129(masses, mubarsq); }
+    else if (masses[3].m == masses[4].m) { return lf128(std::array{masses[0], masses[1], masses[2], masses[3], masses[5]}.data(), mubarsq); }
+    else if (masses[3].m == masses[5].m) { return lf128(masses, mubarsq); }
+    else if (masses[4].m == masses[5].m) { return lf127(masses, mubarsq); }
+    else { return masses[0].sq/((masses[0].sq - masses[1].sq)*(masses[0].sq - masses[2].sq)*(masses[0].sq - masses[3].sq)*(masses[0].sq - masses[4].sq)*(masses[0].sq - masses[5].sq)) + (masses[1].sq*(1 + log(masses[0].sq/masses[1].sq)))/((-masses[0].sq + masses[1].sq)*(masses[1].sq - masses[2].sq)*(masses[1].sq - masses[3].sq)*(masses[1].sq - masses[4].sq)*(masses[1].sq - masses[5].sq)) + (masses[2].sq*(1 + log(masses[0].sq/masses[2].sq)))/((-masses[0].sq + masses[2].sq)*(-masses[1].sq + masses[2].sq)*(masses[2].sq - masses[3].sq)*(masses[2].sq - masses[4].sq)*(masses[2].sq - masses[5].sq)) + (masses[3].sq*(1 + log(masses[0].sq/masses[3].sq)))/((-masses[0].sq + masses[3].sq)*(-masses[1].sq + masses[3].sq)*(-masses[2].sq + masses[3].sq)*(masses[3].sq - masses[4].sq)*(masses[3].sq - masses[5].sq)) + (masses[4].sq*(1 + log(masses[0].sq/masses[4].sq)))/((-masses[0].sq + masses[4].sq)*(-masses[1].sq + masses[4].sq)*(-masses[2].sq + masses[4].sq)*(-masses[3].sq + masses[4].sq)*(masses[4].sq - masses[5].sq)) + (masses[5].sq*(1 + log(masses[0].sq/masses[5].sq)))/((-masses[0].sq + masses[5].sq)*(-masses[1].sq + masses[5].sq)*(-masses[2].sq + masses[5].sq)*(-masses[3].sq + masses[5].sq)*(-masses[4].sq + masses[5].sq)); }
+}
+
+const std::array<LFKernel, lf_num_codes + 1> lf_kernels = {
+    nullptr, lf1<double>, lf2<double>, lf3<double>, lf4<double>, lf5<double>, lf6<double>, lf7<double>, lf8<double>, lf9<double>,
+    lf10<double>, lf11<double>, lf12<double>, lf13<double>, lf14<double>, lf15<double>, lf16<double>, lf17<double>, lf18<double>, lf19<double>,
+    lf20<double>, lf21<double>, lf22<double>, lf23<double>, lf24<double>, lf25<double>, lf26<double>, lf27<double>, lf28<double>, lf29<double>,
+    lf30<double>, lf31<double>, lf32<double>, lf33<double>, lf34<double>, lf35<double>, lf36<double>, lf37<double>, lf38<double>, lf39<double>,
+    lf40<double>, lf41<double>, lf42<double>, lf43<double>, lf44<double>, lf45<double>, lf46<double>, lf47<double>, lf48<double>, lf49<double>,
+    lf50<double>, lf51<double>, lf52<double>, lf53<double>, lf54<double>, lf55<double>, lf56<double>, lf57<double>, lf58<double>, lf59<double>,
+    lf60<double>, lf61<double>, lf62<double>, lf63<double>, lf64<double>, lf65<double>, lf66<double>, lf67<double>, lf68<double>, lf69<double>,
+    lf70<double>, lf71<double>, lf72<double>, lf73<double>, lf74<double>, lf75<double>, lf76<double>, lf77<double>, lf78<double>, lf79<double>,
+    lf80<double>, lf81<double>, lf82<double>, lf83<double>, lf84<double>, lf85<double>, lf86<double>, lf87<double>, lf88<double>, lf89<double>,
+    lf90<double>, lf91<double>, lf92<double>, lf93<double>, lf94<double>, lf95<double>, lf96<double>, lf97<double>, lf98<double>, lf99<double>,
+    lf100<double>, lf101<double>, lf102<double>, lf103<double>, lf104<double>, lf105<double>, lf106<double>, lf107<double>, lf108<double>, lf109<double>,
+    lf110<double>, lf111<double>, lf112<double>, lf113<double>, lf114<double>, lf115<double>, lf116<double>, lf117<double>, lf118<double>, lf119<double>,
+    lf120<double>, lf121<double>, lf122<double>, lf123<double>, lf124<double>, lf125<double>, lf126<double>, lf127<double>, lf128<double>, lf129<double>,
+    lf130<double>, lf131<double>, lf132<double>
+};
+
+static const std::array<Dual (*)(const BasicLFMass<Dual>*, double), lf_num_codes + 1> lf_dual_kernels = {
+    nullptr, lf1<Dual>, lf2<Dual>, lf3<Dual>, lf4<Dual>, lf5<Dual>, lf6<Dual>, lf7<Dual>, lf8<Dual>, lf9<Dual>,
+    lf10<Dual>, lf11<Dual>, lf12<Dual>, lf13<Dual>, lf14<Dual>, lf15<Dual>, lf16<Dual>, lf17<Dual>, lf18<Dual>, lf19<Dual>,
+    lf20<Dual>, lf21<Dual>, lf22<Dual>, lf23<Dual>, lf24<Dual>, lf25<Dual>, lf26<Dual>, lf27<Dual>, lf28<Dual>, lf29<Dual>,
+    lf30<Dual>, lf31<Dual>, lf32<Dual>, lf33<Dual>, lf34<Dual>, lf35<Dual>, lf36<Dual>, lf37<Dual>, lf38<Dual>, lf39<Dual>,
+    lf40<Dual>, lf41<Dual>, lf42<Dual>, lf43<Dual>, lf44<Dual>, lf45<Dual>, lf46<Dual>, lf47<Dual>, lf48<Dual>, lf49<Dual>,
+    lf50<Dual>, lf51<Dual>, lf52<Dual>, lf53<Dual>, lf54<Dual>, lf55<Dual>, lf56<Dual>, lf57<Dual>, lf58<Dual>, lf59<Dual>,
+    lf60<Dual>, lf61<Dual>, lf62<Dual>, lf63<Dual>, lf64<Dual>, lf65<Dual>, lf66<Dual>, lf67<Dual>, lf68<Dual>, lf69<Dual>,
+    lf70<Dual>, lf71<Dual>, lf72<Dual>, lf73<Dual>, lf74<Dual>, lf75<Dual>, lf76<Dual>, lf77<Dual>, lf78<Dual>, lf79<Dual>,
+    lf80<Dual>, lf81<Dual>, lf82<Dual>, lf83<Dual>, lf84<Dual>, lf85<Dual>, lf86<Dual>, lf87<Dual>, lf88<Dual>, lf89<Dual>,
+    lf90<Dual>, lf91<Dual>, lf92<Dual>, lf93<Dual>, lf94<Dual>, lf95<Dual>, lf96<Dual>, lf97<Dual>, lf98<Dual>, lf99<Dual>,
+    lf100<Dual>, lf101<Dual>, lf102<Dual>, lf103<Dual>, lf104<Dual>, lf105<Dual>, lf106<Dual>, lf107<Dual>, lf108<Dual>, lf109<Dual>,
+    lf110<Dual>, lf111<Dual>, lf112<Dual>, lf113<Dual>, lf114<Dual>, lf115<Dual>, lf116<Dual>, lf117<Dual>, lf118<Dual>, lf119<Dual>,
+    lf120<Dual>, lf121<Dual>, lf122<Dual>, lf123<Dual>, lf124<Dual>, lf125<Dual>, lf126<Dual>, lf127<Dual>, lf128<Dual>, lf129<Dual>,
+    lf130<Dual>, lf131<Dual>, lf132<Dual>
+};
+
+double LF(std::span<const double> masses, int code, double mubarsq) {
+    if (code < 1 || code > lf_num_codes) return 0.0;
+    OPERATOR_PROFILE_SCOPE(code);
+    assert((int) masses.size() >= lfArity(code));
+    LFMass args[LFCache::max_masses];
+    for (int i = 0; i < lfArity(code); i++) args[i] = lfMass(masses[i], mubarsq);
+    return lf_kernels[code](args, mubarsq);
+}
+
+double LF(std::span<const LFMass> masses, int code, double mubarsq) {
+    if (code < 1 || code > lf_num_codes) return 0.0;
+    OPERATOR_PROFILE_SCOPE(code);
+    assert((int) masses.size() >= lfArity(code));
+    return lf_kernels[code](masses.data(), mubarsq);
+}
+
+double LF(std::initializer_list<double> masses, int code, double mubarsq) {
+    return LF(std::span<const double>(masses.begin(), masses.size()), code, mubarsq);
+}
+
+Dual LF(std::span<const Dual> masses, int code, double mubarsq) {
+    if (code < 1 || code > lf_num_codes) return 0.0;
+    OPERATOR_PROFILE_SCOPE(code);
+    assert((int) masses.size() >= lfArity(code));
+    const std::array<int, 7> exponents = lfExponents(code);
+    BasicLFMass<Dual> args[LFCache::max_masses];
+    for (int i = 0; i < lfArity(code); i++) {
+        Dual m(masses[i].val);
+        int weight = 0;
+        for (int j = 0; j < lfArity(code); j++) if (masses[j].val == masses[i].val) {
+            weight += exponents[j];
+            for (int d = 0; d < dual_directions; d++) m.der[d] += exponents[j]*masses[j].der[d];
+        }
+        for (int d = 0; d < dual_directions; d++) m.der[d] /= weight;
+        args[i] = BasicLFMass<Dual>(m, mubarsq);
+    }
+    return lf_dual_kernels[code](args, mubarsq);
+}
+
+
+// key of the loop-function cache, the masses beyond n are left at zero
+struct LFKey {
+    int code;
+    int n;
+    double mubarsq;
+    double masses[LFCache::max_masses];
+
+    bool operator==(const LFKey& other) const {
+        if (code != other.code || n != other.n || mubarsq != other.mubarsq) return false;
+        for (int i = 0; i < n; i++) if (masses[i] != other.masses[i]) return false;
+        return true;
+    }
+};
+
+struct LFKeyHash {
+    size_t operator()(const LFKey& key) const {
+        std::hash<double> h;
+        size_t res = key.code*31 + h(key.mubarsq);
+        for (int i = 0; i < key.n; i++) res = res*31 + h(key.masses[i]);
+        return res;
+    }
+};
+
+// slot of the cache, it holds a value only if its epoch is the one of the current state, so that clear does not touch the table
+struct LFCacheSlot {
+    unsigned long long epoch;
+    LFKey key;
+    double value;
+};
+
+// direct-mapped table of lf_cache_slots values, a key evicts the one in its slot on a collision, so that the memory of the cache
+// stays bounded however many parameter points are evaluated between two clears
+static constexpr int lf_cache_slots = 4096;
+
+// state of the cache, separate for every thread so that concurrent evaluations do not need to synchronize
+struct LFCacheState {
+    std::vector<LFCacheSlot> slots = std::vector<LFCacheSlot>(lf_cache_slots, LFCacheSlot{0, {}, 0.0});
+    unsigned long long epoch = 1;
+    std::size_t used = 0;
+    bool on = true;
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+};
+
+static LFCacheState& lfCacheState() {
+    static thread_local LFCacheState state;
+    return state;
+}
+
+double LFCache::eval(std::span<const double> masses, int code, double mubarsq) {
+    LFCacheState& state = lfCacheState();
+    if (!state.on || masses.size() > max_masses) return LF(masses, code, mubarsq);
+
+    LFKey key{code, (int) masses.size(), mubarsq, {}};
+    std::copy(masses.begin(), masses.end(), key.masses);
+
+    LFCacheSlot& slot = state.slots[(LFKeyHash()(key)*0x9E3779B97F4A7C15ull) >> 52];
+    if (slot.epoch == state.epoch && slot.key == key) {
+        state.hits++;
+        return slot.value;
     }
+    state.misses++;
+    if (slot.epoch != state.epoch) state.used++;
+    slot = {state.epoch, key, LF(masses, code, mubarsq)};
+    return slot.value;
+}
+
+double LFCache::eval(std::initializer_list<double> masses, int code, double mubarsq) {
+    return eval(std::span<const double>(masses.begin(), masses.size()), code, mubarsq);
+}
+
+void LFCache::clear() {
+    lfCacheState().epoch++;
+    lfCacheState().used = 0;
+}
+
+void LFCache::enable(bool on) {
+    lfCacheState().on = on;
+    if (!on) clear();
 }
 
+bool LFCache::enabled() { return lfCacheState().on; }
+
+size_t LFCache::size() { return lfCacheState().used; }
+
+unsigned long long LFCache::hits() { return lfCacheState().hits; }
+
+unsigned long long LFCache::misses() { return lfCacheState().misses; }
+
+double LFCache::hitRate() {
+    const LFCacheState& state = lfCacheState();
+    unsigned long long total = state.hits + state.misses;
+    return total == 0 ? 0.0 : (double) state.hits/total;
+}
+
+void LFCache::resetStats() {
+    lfCacheState().hits = 0;
+    lfCacheState().misses = 0;
+}
 
-MassPow::MassPow(variant<vector<double>, double> mass, int exp) {
+MassPow::MassPow(variant<MassVec, double> mass, int exp) {
     this->mass = mass; // this doesn't really have to be a variant, since 0-dim masses, do not enter into the EinsSum call
     this->exp = exp;
 }
 
+DualLoopFunc::DualLoopFunc(vector<variant<DualMassVec, Dual> > list_of_masses, int code, double mubarsq) {
+    this->masses = std::move(list_of_masses);
+    this->code = code;
+    this->mubarsq = mubarsq;
+}
+
+DualMassPow::DualMassPow(variant<DualMassVec, Dual> mass, int exp) {
+    this->mass = mass;
+    this->exp = exp;
+}
+
 // Eval function that operates on a matrix and a vector containing indices {i, j}
-double Eval(const vector<vector<double> >& matrix, const vector<int>& idx) {
+double Eval(const vector<vector<double> >& matrix, std::span<const int> idx) {
     assert(idx.size()==2);
     return matrix[idx[0]][idx[1]];
 }
 
-// overloaded Eval function for the special case of Yukawa functions
-typedef std::tuple<std::function<double(int, int, double)>, double> YF_tuple;
+// Eval function that operates on a view of a matrix with fixed-size storage and a vector containing indices {i, j}
+double Eval(const MatrixView& matrix, std::span<const int> idx) {
+    assert(idx.size()==2);
+    return matrix.data[idx[0]*matrix.num_cols + idx[1]];
+}
 
-double Eval(YF_tuple x, vector<int> idx) {
-   std::function<double(int, int, double)> f = std::get<0>(x);
+// overloaded Eval function for the special case of Yukawa functions
+double Eval(const YF_tuple& x, std::span<const int> idx) {
+   const std::function<double(int, int, double)>& f = std::get<0>(x);
    double mubarsq = std::get<1>(x);
    return f(idx[0], idx[1], mubarsq);
 }
 
 // overloaded Eval function that returns the appropriate loop function for given combination of masses and exponents
-double Eval(LoopFunc loopf, const vector<int>& idx) {
-    vector<double> mass_arg;
+double Eval(const LoopFunc& loopf, std::span<const int> idx) {
+    assert(loopf.masses.size() <= LFCache::max_masses);
+    double mass_arg[LFCache::max_masses];
+    int n = 0;
     int i = 0;
 
-    for (auto mass : loopf.masses) {
-        std::visit([&mass_arg, &idx, &i](auto m){
-            if (dim(m)==0) { mass_arg.emplace_back(apply(m,0)); }
+    for (const auto& mass : loopf.masses) {
+        std::visit([&mass_arg, &n, &idx, &i](const auto& m){
+            if (dim(m)==0) { mass_arg[n++] = apply(m,0); }
             else {
-                mass_arg.emplace_back(apply(m,idx[i]));
+                mass_arg[n++] = apply(m,idx[i]);
                 i++;
             }
         }, mass);
     }
-    return LF(mass_arg, loopf.code, loopf.mubarsq);
+    return LFCache::eval(std::span<const double>(mass_arg, n), loopf.code, loopf.mubarsq);
 }
 
 // overloaded Eval function that operates on a MassPow object and a vector containing zero or one element
-double Eval(MassPow masspw, const vector<int>& idx) {
-    variant<vector<double>, double> mass = masspw.mass;
+double Eval(const MassPow& masspw, std::span<const int> idx) {
     int pw = masspw.exp;
     double res = 1;
 
-    std::visit([&pw, &idx, &res](auto m){ res = exponentiate(m, idx, pw); }, mass);
+    std::visit([&pw, &idx, &res](const auto& m){ res = exponentiate(m, idx, pw); }, masspw.mass);
     return res;
 }
 
+// Eval functions on Dual parameters, in the same way as the ones above but without the loop-function cache
+Dual Eval(const DualMatrixView& matrix, std::span<const int> idx) {
+    assert(idx.size()==2);
+    return matrix.data[idx[0]*matrix.num_cols + idx[1]];
+}
+
+Dual Eval(const DualLoopFunc& loopf, std::span<const int> idx) {
+    assert(loopf.masses.size() <= LFCache::max_masses);
+    Dual mass_arg[LFCache::max_masses];
+    int n = 0;
+    int i = 0;
+
+    for (const auto& mass : loopf.masses) {
+        if (std::holds_alternative<Dual>(mass)) mass_arg[n++] = std::get<Dual>(mass);
+        else mass_arg[n++] = std::get<DualMassVec>(mass)[idx[i++]];
+    }
+    return LF(std::span<const Dual>(mass_arg, n), loopf.code, loopf.mubarsq);
+}
+
+Dual Eval(const DualMassPow& masspw, std::span<const int> idx) {
+    if (std::holds_alternative<Dual>(masspw.mass)) {
+        assert(idx.size()==0);
+        return pow(std::get<Dual>(masspw.mass), masspw.exp);
+    }
+    assert(idx.size()==1);
+    return pow(std::get<DualMassVec>(masspw.mass)[idx[0]], masspw.exp);
+}
+
 // helper to helper functions
-int dim(vector<double>& m) { return 1; }
+int dim(MassVec m) { return 1; }
 
-int dim(double& m) { return 0; }
+int dim(const double& m) { return 0; }
 
-double apply(vector<double>& m, int i) { return m[i]; }
+double apply(MassVec m, int i) { return m[i]; }
 
-double apply(double& m, int i) {
+double apply(const double& m, int i) {
     assert(i==0);
     return m;
 }
 
-double exponentiate(vector<double> m, const vector<int> idx, int pw) {
+double exponentiate(MassVec m, std::span<const int> idx, int pw) {
     assert(idx.size()==1);
     return pow(m[idx[0]], pw);
 }
 
-double exponentiate(double m, const vector<int> idx, int pw) {
+double exponentiate(double m, std::span<const int> idx, int pw) {
     assert(idx.size()==0);
     return pow(m, pw);
 }
@@ -912,41 +1531,6 @@ int maxRepIdx(const vector<vector<int> >& v1) {
     else return *max_element(v2.begin(), v2.end());
 }
 
-// building a vector of vector of addresses while keeping track of the free-indices appropriately.
-vector<vector<int> > idx_seqs(const vector<vector<int> >& index_seqs, const vector<int>& free_indices, const vector<int>& rep_idx_vals){
-    vector<vector<int> > addrs;
-    int free_ind_pos = 0;
-
-    for(vector<int> v : index_seqs) {
-        vector<int> dest;
-        for(int i : v) {
-            if (i>10 && (free_indices.size() > free_ind_pos)) {
-                dest.emplace_back(free_indices[free_ind_pos++]);
-            } else if (i > 10) {
-                throw invalid_argument {"Mismatch in the number of free indices across arguemnts of idx_seqs."};
-            } else dest.emplace_back(rep_idx_vals[i-1]);
-        }
-        addrs.emplace_back(dest);
-    }
-    return addrs;
-}
-
-// overloaded version of idx_seqs for the case where there are no repeated indices and hence no arr_of_ptrs
-vector<vector<int> > idx_seqs(const vector<vector<int> >& index_seqs, const vector<int>& free_indices){
-    vector<vector<int> > addrs;
-    int free_ind_pos = 0;
-
-    for(vector<int> v : index_seqs) {
-        vector<int> dest;
-        for(int i : v) {
-            if (i>10 && (free_indices.size() > free_ind_pos)) dest.emplace_back(free_indices[free_ind_pos++]);
-            else if (i > 10) throw invalid_argument {"Mismatch in the number of free indices across arguemnts of idx_seqs."};
-        }
-        addrs.emplace_back(dest);
-    }
-    return addrs;
-}
-
 // generating all possible combinations of values assumed by the repeated indices
 vector<vector<int> > cartesianProduct(int num_flavours, int num_idx) {
     // For now we assume that all the flavourful couplings in the model have dimension (num_flavours x num_flavours)
@@ -966,47 +1550,214 @@ vector<vector<int> > cartesianProduct(int num_flavours, int num_idx) {
     return allProducts;
 }
 
-// Einstein summation function for a variant containing (a loop function, a mass raised to some power, matrices or the Yukawa functions)
-// and a specified ordering of repeated & free indices
-double EinsSum(vector<variant<LoopFunc, MassPow, vector<vector<double> >, YF_tuple> > tensor_objs, vector<vector<int> > index_order, vector<int> free_indices) {
-    int num_flavours = 3;   // hardcoded for now, should never be 0 or negative
-    int num_idx = maxRepIdx(index_order);
-
-    double sum{};
-    // vector<vector<int> > segregated_seqs;
-    // vector<double> res1;
+size_t IndexOrderHash::operator()(const vector<vector<int> >& index_order) const {
+    size_t h = index_order.size();
+    for (const vector<int>& v : index_order) {
+        h = h*31 + 17;  // marks the boundary between tensors, so that {{1},{2}} and {{1,2}} differ
+        for (int i : v) h = h*31 + i;
+    }
+    return h;
+}
 
-    if (num_idx == 0) { // if there are no repeated indices, we only need to evaluate once, no looping necessary
-        vector<vector<int> > segregated_seqs = idx_seqs(index_order, free_indices);
-        vector<double> res1;
+// translating an index_order pattern into flat tables of slot positions, done once per pattern
+ContractionPlan::ContractionPlan(const vector<vector<int> >& index_order, int num_flavours) {
+    this->num_idx = maxRepIdx(index_order);
+    this->num_slots = 0;
 
-        for (int k = 0; k < tensor_objs.size(); k++) {
-            std::visit([&res1, &segregated_seqs, &k](auto obj){
-                res1.emplace_back(Eval(obj, segregated_seqs[k]));
-                }, tensor_objs[k]);
+    for (const vector<int>& v : index_order) {
+        this->tensor_offsets.emplace_back(this->num_slots);
+        this->pattern += this->pattern.empty() ? "{{" : ",{";
+        for (int i : v) {
+            if (i > 10) this->free_slots.emplace_back(this->num_slots);
+            else this->rep_slots.emplace_back(this->num_slots);
+            this->pattern += (this->num_slots == this->tensor_offsets.back() ? "" : ",") + std::to_string(i);
+            this->num_slots++;
         }
+        this->pattern += "}";
+    }
+    this->pattern += index_order.empty() ? "{}" : "}";
+    this->tensor_offsets.emplace_back(this->num_slots);
 
-        sum = accumulate(res1.begin(), res1.end(), 1.0, std::multiplies<double>());
+    if (this->num_slots > max_slots) throw invalid_argument {"Too many indices in the index_order of EinsSum."};
 
+    if (this->num_idx == 0) {
+        this->num_combos = 1;
     } else {
-        vector<vector<int> > cprod = cartesianProduct(num_flavours, num_idx);
+        vector<vector<int> > cprod = cartesianProduct(num_flavours, this->num_idx);
+        this->num_combos = cprod.size();
+
+        // the labels of the repeated slots, in the same order as rep_slots
+        vector<int> rep_labels;
+        for (const vector<int>& v : index_order)
+            for (int i : v)
+                if (i <= 10) rep_labels.emplace_back(i);
+
+        for (const vector<int>& seq : cprod)
+            for (int label : rep_labels)
+                this->rep_table.emplace_back(seq[label-1]);
+    }
+}
+
+// evaluating the contraction for a given set of tensors and free indices, without any heap allocation, on double and on Dual tensors
+template <class T, class Obj>
+static T contractPlan(const ContractionPlan& plan, const vector<Obj>& tensor_objs, const vector<int>& free_indices) {
+    if (free_indices.size() < plan.free_slots.size())
+        throw invalid_argument {"Mismatch in the number of free indices across arguemnts of EinsSum."};
+
+    OPERATOR_PROFILE_SCOPE(&plan);
 
-        for (vector<int> seq : cprod) {
-            // segregated_seqs.clear();
-            // res1.clear();
+    int slots[ContractionPlan::max_slots];
+    for (size_t f = 0; f < plan.free_slots.size(); f++) slots[plan.free_slots[f]] = free_indices[f];
 
-            vector<vector<int> > segregated_seqs = idx_seqs(index_order, free_indices, seq);
-            vector<double> res1;
-            for (int k = 0; k < tensor_objs.size(); k++)
-                std::visit([&res1, &segregated_seqs, &k](auto obj){res1.emplace_back(Eval(obj, segregated_seqs[k]));}, tensor_objs[k]);
+    const int num_rep_slots = plan.rep_slots.size();
+    const int* rep_vals = plan.rep_table.data();
+    T sum{};
 
-            double res2 = accumulate(res1.begin(), res1.end(), 1.0, std::multiplies<double>());
-            sum += res2;
+    for (int c = 0; c < plan.num_combos; c++, rep_vals += num_rep_slots) {
+        for (int r = 0; r < num_rep_slots; r++) slots[plan.rep_slots[r]] = rep_vals[r];
+
+        T prod = 1.0;
+        for (size_t k = 0; k < tensor_objs.size(); k++) {
+            std::span<const int> idx(slots + plan.tensor_offsets[k], slots + plan.tensor_offsets[k+1]);
+            prod = prod*std::visit([&idx](const auto& obj){ return T(Eval(obj, idx)); }, tensor_objs[k]);
         }
+        sum += prod;
     }
     return sum;
 }
 
+double ContractionPlan::contract(const vector<TensorObj>& tensor_objs, const vector<int>& free_indices) const {
+    return contractPlan<double>(*this, tensor_objs, free_indices);
+}
+
+Dual ContractionPlan::contract(const vector<DualTensorObj>& tensor_objs, const vector<int>& free_indices) const {
+    return contractPlan<Dual>(*this, tensor_objs, free_indices);
+}
+
+// plans are cached per thread and keyed by the number of flavours and the index_order pattern, since the same patterns recur across all WC functions
+const ContractionPlan& ContractionPlan::get(const vector<vector<int> >& index_order, int num_flavours) {
+    static thread_local std::unordered_map<int, std::unordered_map<vector<vector<int> >, ContractionPlan, IndexOrderHash> > all_plans;
+    if (num_flavours <= 0) throw invalid_argument {"The number of flavours has to be positive."};
+
+    auto& plans = all_plans[num_flavours];
+    auto it = plans.find(index_order);
+    if (it == plans.end()) it = plans.emplace(index_order, ContractionPlan(index_order, num_flavours)).first;
+    return it->second;
+}
+
+#ifdef OPERATOR_PROFILE
+struct ProfileCounter {
+    unsigned long long calls = 0;
+    double seconds = 0.0;
+
+    void add(const ProfileCounter& other) {
+        calls += other.calls;
+        seconds += other.seconds;
+    }
+};
+
+// counters keyed by text, since the plans and the string literals of the methods differ between threads and translation units
+struct ProfileCounters {
+    std::map<std::string, ProfileCounter> loop_functions;
+    std::map<std::string, ProfileCounter> contractions;
+    std::map<std::string, ProfileCounter> methods;
+};
+
+static void writeProfile(std::ostream& out, const ProfileCounters& counters) {
+    out << "kind,key,calls,seconds,ns_per_call\n";
+    auto write = [&out](const std::string& kind, const std::map<std::string, ProfileCounter>& table) {
+        vector<std::pair<std::string, ProfileCounter> > sorted(table.begin(), table.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b){ return a.second.seconds > b.second.seconds; });
+        for (const auto& [key, counter] : sorted)
+            out << std::format("{},\"{}\",{},{:.6e},{:.6e}", kind, key, counter.calls, counter.seconds, 1e9*counter.seconds/counter.calls) << "\n";
+    };
+    write("lf", counters.loop_functions);
+    write("einssum", counters.contractions);
+    write("method", counters.methods);
+}
+
+// totals of the finished threads, written to stderr when the program ends (after the data of the main thread is merged in)
+struct ProfileTotals {
+    std::mutex mutex;
+    ProfileCounters counters;
+
+    ~ProfileTotals() {
+        if (!counters.loop_functions.empty() || !counters.contractions.empty() || !counters.methods.empty()) writeProfile(std::cerr, counters);
+    }
+};
+
+static ProfileTotals& profileTotals() {
+    static ProfileTotals totals;
+    return totals;
+}
+
+// counters of one thread, merged into the totals when the thread ends
+struct ProfileThreadData {
+    std::array<ProfileCounter, lf_num_codes + 1> loop_functions{};
+    std::unordered_map<const ContractionPlan*, std::pair<std::string, ProfileCounter> > contractions;
+    std::unordered_map<const char*, ProfileCounter> methods;
+
+    // the totals are constructed first, so that they outlive the data of every thread
+    ProfileThreadData() {
+        profileTotals();
+    }
+
+    void mergeInto(ProfileCounters& counters) const {
+        for (int code = 1; code <= lf_num_codes; code++)
+            if (loop_functions[code].calls != 0) counters.loop_functions[std::to_string(code)].add(loop_functions[code]);
+        for (const auto& [plan, entry] : contractions) counters.contractions[entry.first].add(entry.second);
+        for (const auto& [method, counter] : methods) counters.methods[method].add(counter);
+    }
+
+    ~ProfileThreadData() {
+        ProfileTotals& totals = profileTotals();
+        std::lock_guard<std::mutex> lock(totals.mutex);
+        mergeInto(totals.counters);
+    }
+};
+
+static ProfileThreadData& profileThreadData() {
+    static thread_local ProfileThreadData data;
+    return data;
+}
+
+ProfileScope::~ProfileScope() {
+    const ProfileCounter elapsed{1, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+    ProfileThreadData& data = profileThreadData();
+
+    if (kind == 0) {
+        data.loop_functions[code].add(elapsed);
+    } else if (kind == 1) {
+        const ContractionPlan* plan = static_cast<const ContractionPlan*>(key);
+        auto it = data.contractions.find(plan);
+        if (it == data.contractions.end()) it = data.contractions.emplace(plan, std::make_pair(plan->pattern, ProfileCounter{})).first;
+        it->second.second.add(elapsed);
+    } else {
+        data.methods[static_cast<const char*>(key)].add(elapsed);
+    }
+}
+
+void Profiler::report(std::ostream& out) {
+    ProfileTotals& totals = profileTotals();
+    std::lock_guard<std::mutex> lock(totals.mutex);
+
+    ProfileCounters current = totals.counters;
+    profileThreadData().mergeInto(current);
+    writeProfile(out, current);
+}
+
+void Profiler::reset() {
+    ProfileTotals& totals = profileTotals();
+    std::lock_guard<std::mutex> lock(totals.mutex);
+    totals.counters = ProfileCounters{};
+
+    ProfileThreadData& data = profileThreadData();
+    data.loop_functions.fill(ProfileCounter{});
+    data.contractions.clear();
+    data.methods.clear();
+}
+#endif
+
 // Kronecker delta function
 int KronDelta(int a, int b) {
   if (a==b) return 1;
@@ -0,0 +1,225 @@
+/**
+ * @file bench.cpp
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Benchmarks of the OperatorImport helpers and of the generated MSSM class, written as csv to stdout
+ *
+ * usage: bench.out [min_seconds] [filter]
+ * every case runs for at least min_seconds (default 0.05), only cases whose group/case name contains filter are run
+ * columns: group, case, unit, count (calls or points), seconds, ns_per_unit (latency), units_per_second (throughput)
+ */
+
+#include "MSSM.h"
+#include "ParameterScan.h"
+#include "AdaptiveScan.h"
+#include "Surrogate.h"
+#include "OperatorImport.h"
+#include <vector>
+#include <array>
+#include <string>
+#include <map>
+#include <format>
+#include <iostream>
+#include <chrono>
+#include <functional>
+
+using std::vector;
+using std::array;
+using std::map;
+using std::string;
+using std::format;
+
+// results are written here, so that the compiler cannot drop the benchmarked calls
+static volatile double sink = 0.0;
+
+// parameter point of write_to_files: light stop and Bino, all other superpartners heavy
+static map<string, double> benchParams() {
+    map<string, double> params = {{"g1", 0.37}, {"g2", 0.65}, {"g3", 1.1}, {"cgamma", 0.01}, {"mHsq", 0.125*0.125},
+        {"yu11", 0.00001}, {"yu22", 0.007}, {"yu33", 0.9}, {"mut3", 1.6}, {"m1", 1.5}};
+
+    const vector<string> heavy_masses = {"m3", "m2", "mPhi", "muTilde", "met1", "met2", "met3", "mlt1", "mlt2", "mlt3",
+        "mqt1", "mqt2", "mqt3", "mdt1", "mdt2", "mdt3", "mut1", "mut2"};
+    double i = 0.0;
+    for (const string& mass : heavy_masses) {
+        params.emplace(mass, 1'000'000.0 + i);
+        i += 1000;
+    }
+    return params;
+}
+
+class Bench {
+    public:
+        double min_time;
+        string filter;
+
+        Bench(double min_time, string filter) : min_time(min_time), filter(filter) {
+            std::cout << "group,case,unit,count,seconds,ns_per_unit,units_per_second\n";
+        }
+
+        // runs f (returning a double) repeatedly for at least min_time, every call counts as units_per_call units
+        template <class F>
+        void run(const string& group, const string& name, F&& f, const string& unit = "call", std::size_t units_per_call = 1) {
+            if (!filter.empty() && (group + "/" + name).find(filter) == string::npos) return;
+
+            using clock = std::chrono::steady_clock;
+            sink = f();    // warm-up, e.g. for the contraction plans of EinsSum
+
+            std::size_t calls = 0;
+            std::size_t batch = 1;
+            double elapsed = 0.0;
+            const auto start = clock::now();
+            while (elapsed < min_time) {
+                for (std::size_t k = 0; k < batch; k++) sink = f();
+                calls += batch;
+                elapsed = std::chrono::duration<double>(clock::now() - start).count();
+                // batches grow until a clock read is negligible against them
+                if (elapsed < min_time/100) batch *= 2;
+            }
+
+            const double count = static_cast<double>(calls*units_per_call);
+            std::cout << format("{},{},{},{},{:.6e},{:.6e},{:.6e}", group, name, unit, calls*units_per_call, elapsed, 1e9*elapsed/count, count/elapsed) << "\n";
+        }
+};
+
+// all 132 loop-function codes with distinct masses, and with degenerate masses, which take the separate branches of the kernels
+static void benchLoopFunctions(Bench& bench) {
+    const array<double, 6> distinct = {0.8, 1.3, 1.9, 2.6, 3.4, 4.1};
+    const double mubarsq = 1.0;
+
+    for (int code = 1; code <= lf_num_codes; code++) {
+        const int n = lfArity(code);
+        array<double, 6> masses = distinct;
+        bench.run("lf", std::to_string(code), [&]{ return LF(std::span<const double>(masses.data(), n), code, mubarsq); });
+
+        if (n >= 3) {
+            array<double, 6> pair = distinct;
+            pair[1] = pair[0];
+            bench.run("lf", std::to_string(code) + "/m1=m2", [&]{ return LF(std::span<const double>(pair.data(), n), code, mubarsq); });
+        }
+        if (n >= 2) {
+            array<double, 6> equal;
+            equal.fill(distinct[0]);
+            bench.run("lf", std::to_string(code) + "/degenerate", [&]{ return LF(std::span<const double>(equal.data(), n), code, mubarsq); });
+        }
+    }
+}
+
+// EinsSum over chains of 3x3 matrices with 0 to 4 repeated indices, and with a loop function carrying a flavour index
+static void benchEinsSum(Bench& bench) {
+    typedef array<array<double, 3>, 3> Matrix;
+    array<Matrix, 5> y;
+    for (int t = 0; t < 5; t++) for (int i = 0; i < 3; i++) for (int j = 0; j < 3; j++) y[t][i][j] = 0.1*(t + 1) + 0.03*i - 0.02*j;
+    const array<double, 3> mq = {1.1, 1.4, 1.7};
+    const double m1 = 0.8;
+    const double mubarsq = 1.0;
+
+    bench.run("einssum", "0 repeated", [&]{ return EinsSum<3>({y[0]}, {{11, 12}}, {2, 1}); });
+    bench.run("einssum", "1 repeated", [&]{ return EinsSum<3>({y[0], y[1]}, {{11, 1}, {1, 12}}, {2, 1}); });
+    bench.run("einssum", "2 repeated", [&]{ return EinsSum<3>({y[0], y[1], y[2]}, {{11, 1}, {1, 2}, {2, 12}}, {2, 1}); });
+    bench.run("einssum", "3 repeated", [&]{ return EinsSum<3>({y[0], y[1], y[2], y[3]}, {{11, 1}, {1, 2}, {2, 3}, {3, 12}}, {2, 1}); });
+    bench.run("einssum", "4 repeated", [&]{ return EinsSum<3>({y[0], y[1], y[2], y[3], y[4]}, {{11, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 12}}, {2, 1}); });
+    bench.run("einssum", "1 repeated/loopfunc", [&]{
+        return EinsSum<3>({LoopFunc({m1, mq}, 29, mubarsq), y[0], y[1]}, {{1}, {11, 1}, {1, 12}}, {2, 1});
+    });
+}
+
+static void benchModel(Bench& bench) {
+    const map<string, double> params = benchParams();
+    MSSM model(params);
+
+    bench.run("model", "updateParams", [&]{ model.updateParams(params); return 0.0; });
+
+    // every WC on its own through evaluate, the scale alternates and the loop-function cache is cleared,
+    // so that neither the incremental evaluation nor the cache skips any of the work
+    double mubarsq = 1.0;
+    for (const string& name : MSSM::wcNames()) {
+        bench.run("wc", name, [&]{
+            mubarsq = (mubarsq == 1.0) ? 1.0 + 1e-9 : 1.0;
+            LFCache::clear();
+            return model.evaluate(mubarsq, {name}).cG;
+        });
+    }
+    bench.run("model", "evaluateAll", [&]{
+        mubarsq = (mubarsq == 1.0) ? 1.0 + 1e-9 : 1.0;
+        LFCache::clear();
+        return model.evaluateAll(mubarsq).cG;
+    });
+
+    // the same with the term groups of the decoupled states pruned below 1e-12
+    MSSM pruned(params);
+    pruned.setPruning(1e-12);
+    bench.run("model", "evaluateAll pruned", [&]{
+        mubarsq = (mubarsq == 1.0) ? 1.0 + 1e-9 : 1.0;
+        LFCache::clear();
+        return pruned.evaluateAll(mubarsq).cG;
+    });
+}
+
+// end-to-end scans over the (mut3, m1) plane as in write_to_files, in points per second
+static void benchScans(Bench& bench) {
+    const map<string, double> params = benchParams();
+    const double mubarsq = 1.0;
+
+    // the 2d plots: the top-pair WCs on a multithreaded ParameterScan
+    ParameterScan<MSSM> scan(params, {{"mut3", 0.3, 2.7, 5}, {"m1", 0.3, 2.7, 5}});
+    const vector<std::function<double(MSSM&)> > funcs = {
+        [mubarsq](MSSM& m){ return m.cG(mubarsq); },
+        [mubarsq](MSSM& m){ return m.cuG(2, 2, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cqu1(0, 0, 2, 2, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cuu(2, 2, 2, 2, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cqq1(2, 2, 2, 2, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cqd1(2, 2, 0, 0, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cqu8(2, 2, 0, 0, mubarsq); },
+        [mubarsq](MSSM& m){ return m.cqu8(0, 0, 2, 2, mubarsq); }
+    };
+    bench.run("scan", "ParameterScan", [&]{ return scan.run(funcs).back(); }, "point", scan.size());
+
+    // the same plane refined from a 3x3 grid to at most the spacing of the 5x5 grid, in evaluated points per second
+    AdaptiveScan<MSSM> adaptive(params, {{"mut3", 0.3, 2.7, 3}, {"m1", 0.3, 2.7, 3}}, 1, 0.01);
+    adaptive.run(funcs);
+    bench.run("scan", "AdaptiveScan", [&]{ return adaptive.run(funcs).back(); }, "point", adaptive.size());
+
+    // the bar charts: the same WCs from evaluate, with only mut3 and m1 changing between the points
+    MSSM model(params);
+    bench.run("scan", "evaluate", [&]{
+        double res = 0.0;
+        for (std::size_t n = 0; n < scan.size(); n++) {
+            const vector<double> pt = scan.point(n);
+            model.setParam(MSSM::Param::mut3, pt[0]);
+            model.setParam(MSSM::Param::m1, pt[1]);
+            res += model.evaluate(mubarsq, {"cG", "cuG", "cqu1", "cuu", "cqq1", "cqd1", "cqu8"}).cuG[8];
+        }
+        return res;
+    }, "point", scan.size());
+}
+
+// queries of a table of cuG_33 on the (mut3, m1) plane, at points moving through the plane
+static void benchSurrogate(Bench& bench) {
+    ParameterScan<MSSM> scan(benchParams(), {{"mut3", 0.3, 2.7, 9}, {"m1", 0.3, 2.7, 9}});
+    Surrogate<MSSM> surrogate(scan, {"cuG_33"}, {[](MSSM& m){ return m.cuG(2, 2, 1.0); }});
+
+    for (Interpolation interpolation : {Interpolation::linear, Interpolation::cubic}) {
+        surrogate.interpolation = interpolation;
+        double u = 0.0, v = 0.0;
+        bench.run("surrogate", interpolation == Interpolation::linear ? "linear" : "cubic", [&]{
+            u += 0.0137;
+            v += 0.0071;
+            if (u > 1.0) u -= 1.0;
+            if (v > 1.0) v -= 1.0;
+            const array<double, 2> x = {0.3 + 2.4*u, 0.3 + 2.4*v};
+            return surrogate(x, 0).value;
+        }, "query");
+    }
+}
+
+int main(int argc, char** argv) {
+    Bench bench(argc > 1 ? std::stod(argv[1]) : 0.05, argc > 2 ? argv[2] : "");
+
+    benchLoopFunctions(bench);
+    benchEinsSum(bench);
+    benchModel(bench);
+    benchScans(bench);
+    benchSurrogate(bench);
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file check.cpp
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Consistency checks of the scan utilities on the generated MSSM class, run by make check
+ *
+ * every check prints one line with its result, the exit code is the number of failed checks
+ */
+
+#include "MSSM.h"
+#include "ParameterScan.h"
+#include "Surrogate.h"
+#include <vector>
+#include <array>
+#include <string>
+#include <map>
+#include <format>
+#include <iostream>
+#include <functional>
+#include <filesystem>
+#include <exception>
+#include <algorithm>
+#include <cmath>
+
+using std::vector;
+using std::array;
+using std::map;
+using std::string;
+using std::format;
+
+// parameter point of write_to_files: light stop and Bino, all other superpartners heavy
+static map<string, double> checkParams() {
+    map<string, double> params = {{"g1", 0.37}, {"g2", 0.65}, {"g3", 1.1}, {"cgamma", 0.01}, {"mHsq", 0.125*0.125},
+        {"yu11", 0.00001}, {"yu22", 0.007}, {"yu33", 0.9}, {"mut3", 1.6}, {"m1", 1.5}};
+
+    const vector<string> heavy_masses = {"m3", "m2", "mPhi", "muTilde", "met1", "met2", "met3", "mlt1", "mlt2", "mlt3",
+        "mqt1", "mqt2", "mqt3", "mdt1", "mdt2", "mdt3", "mut1", "mut2"};
+    double i = 0.0;
+    for (const string& mass : heavy_masses) {
+        params.emplace(mass, 1'000'000.0 + i);
+        i += 1000;
+    }
+    return params;
+}
+
+// a table saved and loaded again (twice) has the same axes and answers every query as the original, the mut3 axis is one whose
+// largest grid point is rounded away from its max
+static string checkSurrogateRoundTrip() {
+    const map<string, double> params = checkParams();
+    const ParameterScan<MSSM> scan(params, {{"mut3", 2.5, 3.9, 25}, {"m1", 0.3, 2.7, 4}});
+    Surrogate<MSSM> surrogate(scan, {"cG", "cuG_33"}, {[](MSSM& m){ return m.cG(1.0); }, [](MSSM& m){ return m.cuG(2, 2, 1.0); }});
+
+    const string path = (std::filesystem::temp_directory_path()/"check_surrogate.scan").string();
+    surrogate.save(path);
+    Surrogate<MSSM> loaded(path, params);
+    loaded.save(path);
+    Surrogate<MSSM> reloaded(path, params);
+    std::filesystem::remove(path);
+
+    for (const Surrogate<MSSM>* s : {&loaded, &reloaded}) {
+        if (s->coefficientNames() != surrogate.coefficientNames()) return "coefficient names differ";
+        for (std::size_t a = 0; a < 2; a++) {
+            const ScanAxis& x = surrogate.gridAxes()[a];
+            const ScanAxis& y = s->gridAxes()[a];
+            if (x.name != y.name || x.num_points != y.num_points || x.min != y.min || x.max != y.max)
+                return "axis " + x.name + " differs";
+        }
+    }
+
+    // the grid points and the middle of every cell
+    for (std::size_t n = 0; n < scan.size(); n++) {
+        const vector<double> pt = scan.point(n);
+        for (double shift : {0.0, 0.5}) {
+            const array<double, 2> x = {std::min(pt[0] + shift*1.4/24, 3.9), std::min(pt[1] + shift*2.4/3, 2.7)};
+            for (std::size_t c = 0; c < 2; c++) {
+                const double expected = surrogate(x, c).value;
+                for (Surrogate<MSSM>* s : {&loaded, &reloaded}) {
+                    const double value = (*s)(x, c).value;
+                    if (std::abs(value - expected) > 1e-12*std::abs(expected)) return format("query {} of {} differs: {} instead of {}", n, c, value, expected);
+                }
+            }
+        }
+    }
+    return "";
+}
+
+// the batched methods agree with the single-point ones on a block whose size is not a multiple of batch_block, and leave the
+// parameters of the model as they were
+static string checkBatch() {
+    const map<string, double> params = checkParams();
+    const std::size_t num = MSSM::batch_block + 5;
+    MSSMBatch points(num, params);
+    for (std::size_t n = 0; n < num; n++) {
+        points.mut3[n] = 0.5 + 0.1*n;
+        points.m1[n] = 2.0 - 0.05*n;
+        points.cgamma[n] = 0.01*n;
+    }
+
+    MSSM model(params);
+    array<double, MSSM::num_params> before, after;
+    model.getParams(before.data());
+    vector<double> cG(num), cuG(9*num);
+    model.cG_batch(points, 1.0, cG.data());
+    model.cuG_batch(points, 1.0, cuG.data());
+    model.getParams(after.data());
+    if (before != after) return "the parameters of the model changed";
+
+    for (std::size_t n = 0; n < num; n++) {
+        MSSM single(params);
+        single.setParam(MSSMParam::mut3, points.mut3[n]);
+        single.setParam(MSSMParam::m1, points.m1[n]);
+        single.setParam(MSSMParam::cgamma, points.cgamma[n]);
+        array<double, 9> expected;
+        single.cuG_all(1.0, expected.data());
+        if (std::abs(cG[n] - single.cG(1.0)) > 1e-12*std::abs(cG[n])) return format("cG at point {}: {} instead of {}", n, cG[n], single.cG(1.0));
+        for (std::size_t c = 0; c < 9; c++) {
+            if (std::abs(cuG[c*num + n] - expected[c]) > 1e-12*std::abs(expected[c])) return format("cuG component {} at point {}: {} instead of {}", c, n, cuG[c*num + n], expected[c]);
+        }
+    }
+    return "";
+}
+
+// the values of derivatives are those of evaluate, and the derivatives agree with central differences; nine directions take two
+// passes of dual_directions
+static string checkDerivatives() {
+    const map<string, double> params = checkParams();
+    const vector<string> wcs = {"cG", "cuG"};
+    const vector<MSSMParam> directions = {MSSMParam::mut3, MSSMParam::m1, MSSMParam::g3, MSSMParam::yu33, MSSMParam::cgamma,
+        MSSMParam::mHsq, MSSMParam::au33, MSSMParam::g1, MSSMParam::mqt3};
+
+    MSSM model(params);
+    const MSSMDerivatives d = model.derivatives(1.0, wcs, directions);
+    const MSSMCoefficients value = model.evaluate(1.0, wcs);
+    if (d.value.cG != value.cG || d.value.cuG != value.cuG) return "the values differ from evaluate";
+
+    for (std::size_t j = 0; j < directions.size(); j++) {
+        const double x = model.getParam(directions[j]);
+        const double h = 1e-4*std::max(std::abs(x), 0.1);
+        MSSM plus(params), minus(params);
+        plus.setParam(directions[j], x + h);
+        minus.setParam(directions[j], x - h);
+        const MSSMCoefficients a = plus.evaluate(1.0, wcs);
+        const MSSMCoefficients b = minus.evaluate(1.0, wcs);
+        vector<double> numeric = {(a.cG - b.cG)/(2*h)}, exact = {d.gradient[j].cG};
+        for (std::size_t c = 0; c < 9; c++) {
+            numeric.push_back((a.cuG[c] - b.cuG[c])/(2*h));
+            exact.push_back(d.gradient[j].cuG[c]);
+        }
+        double scale = 0.0;
+        for (double e : exact) scale = std::max(scale, std::abs(e));
+        for (std::size_t c = 0; c < exact.size(); c++) {
+            if (std::abs(exact[c] - numeric[c]) > 1e-6*scale + 1e-15) return format("derivative {} of component {}: {} instead of {}", j, c, exact[c], numeric[c]);
+        }
+    }
+    return "";
+}
+
+int main() {
+    const vector<std::pair<string, std::function<string()> > > checks = {
+        {"surrogate save/load round trip", checkSurrogateRoundTrip},
+        {"batch against single points", checkBatch},
+        {"derivatives against finite differences", checkDerivatives}
+    };
+
+    int failed = 0;
+    for (const auto& [name, check] : checks) {
+        string error;
+        try {
+            error = check();
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        std::cout << format("{}: {}", name, error.empty() ? "passed" : "FAILED, " + error) << "\n";
+        failed += !error.empty();
+    }
+    return failed;
+}
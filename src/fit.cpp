@@ -0,0 +1,96 @@
+/**
+ * @file fit.cpp
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Parallel-tempered MCMC fit of MSSM masses to Gaussian bounds on top-sector WCs, writing the chain as csv
+ *
+ * usage: fit.out [num_steps] [burn_in] [seed] [num_threads] [file]
+ * defaults: 2000 steps after 200 burn-in steps, seed 1, all hardware threads, ./plots/fit.csv
+ * the state is checkpointed to file.ckpt every 100 steps; if that checkpoint exists the run continues from it and appends to file
+ */
+
+#include "MSSM.h"
+#include "TemperedMCMC.h"
+#include "ResultWriter.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <iostream>
+#include <filesystem>
+#include <algorithm>
+#include <functional>
+
+using std::vector;
+using std::map;
+using std::string;
+
+int main(int argc, char** argv) {
+    const std::size_t num_steps = argc > 1 ? std::stoull(argv[1]) : 2000;
+    const std::size_t burn_in = argc > 2 ? std::stoull(argv[2]) : 200;
+    const std::uint64_t seed = argc > 3 ? std::stoull(argv[3]) : 1;
+    const unsigned num_threads = argc > 4 ? std::stoul(argv[4]) : 0;
+    const string f_name = argc > 5 ? argv[5] : "./plots/fit.csv";
+
+    double mubarsq = 1.0*1.0; // We set the renormalization scale close to 1 TeV
+
+    // gauge couplings and SM Yukawas as in write_to_files, unspecified parameters remain zero
+    map<string, double> param_dict = {{"g1", 0.37}, {"g2", 0.65}, {"g3", 1.1}, {"cgamma", 0.01}, {"mHsq", 0.125*0.125},
+        {"yu11", 0.00001}, {"yu22", 0.007}, {"yu33", 0.9}};
+    for (string mass : {"m1", "m2", "mPhi", "muTilde", "mqt1", "mqt2", "mut1", "mut2", "mdt1", "mdt2", "mdt3",
+                        "mlt1", "mlt2", "mlt3", "met1", "met2", "met3"}) {
+        param_dict[mass] = 2.0;
+    }
+
+    // gluino and third-generation squark masses, log-uniform between 0.3 and 5 TeV
+    const vector<SampleAxis> axes = {{"m3", 0.3, 5.0, SampleScale::log}, {"mqt3", 0.3, 5.0, SampleScale::log}, {"mut3", 0.3, 5.0, SampleScale::log}};
+
+    // illustrative bounds, all WCs from one incremental evaluate per step
+    const vector<string> wc_names = {"cG", "cuG", "cqu8"};
+    const vector<GaussianConstraint<MSSM> > constraints = {{"cG", {}, 0.0, 1e-6}, {"cuG_33", {}, 0.0, 1e-5}, {"cqu8_3311", {}, 0.0, 1e-5}};
+
+    TemperedMCMC<MSSM> mcmc(param_dict, axes, constraints, 4, 10.0, 4, seed);
+    mcmc.fill = [&](MSSM& m, double* values){
+        const MSSMCoefficients wc = m.evaluate(mubarsq, wc_names);
+        values[0] = wc.cG;
+        values[1] = wc.cuG[8];      // cuG_33
+        values[2] = wc.cqu8[72];    // cqu8_3311
+    };
+    mcmc.burn_in = burn_in;
+    mcmc.checkpoint_path = f_name + ".ckpt";
+    mcmc.checkpoint_every = 100;
+
+    const bool resume = std::filesystem::exists(mcmc.checkpoint_path);
+    if (resume) {
+        mcmc.loadCheckpoint(mcmc.checkpoint_path);
+        std::cout << "continuing from step " << mcmc.steps() << " of " << mcmc.checkpoint_path << "\n";
+    }
+
+    // after an interrupted run the steps between the last checkpoint and the interruption appear twice, the step column tells them apart
+    string first_row = "step,replica,";
+    for (const SampleAxis& axis : axes) first_row += axis.name + ",";
+    first_row += "log_likelihood";
+    for (const GaussianConstraint<MSSM>& c : constraints) first_row += "," + c.name;
+
+    vector<TextColumn> columns(2, {std::chars_format::fixed, 0});
+    columns.resize(2 + axes.size() + 1 + constraints.size(), {std::chars_format::scientific, 6});
+
+    AsyncTextWriter file(f_name, columns, ',', resume ? std::ios::app : std::ios::trunc);
+    if (!resume) file.writeLine(first_row);
+
+    vector<double> row(columns.size());
+    mcmc.run(num_steps, [&](std::size_t step, std::size_t replica, const double* state){
+        row[0] = static_cast<double>(step);
+        row[1] = static_cast<double>(replica);
+        std::copy(state, state + columns.size() - 2, row.begin() + 2);
+        file.writeRow(row);
+    }, num_threads);
+    file.close();
+
+    for (std::size_t k = 0; k < mcmc.temperatures.size(); k++) {
+        std::cout << "T = " << mcmc.temperatures[k] << ": acceptance " << mcmc.acceptanceRate(mcmc.chainIndex(0, k));
+        if (k + 1 < mcmc.temperatures.size()) std::cout << ", swaps with the next temperature " << mcmc.swapRate(k);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file sample.cpp
+ * @author Suraj Prakash
+ * @date 2026-10-17
+ * @brief Monte Carlo scan of the MSSM superpartner masses, writing the sampled points and WCs as csv
+ *
+ * usage: sample.out [num_points] [random|lhs] [seed] [num_threads] [file]
+ * defaults: 10000 Latin-hypercube points, seed 1, all hardware threads, ./plots/sample.csv
+ * the output only depends on the number of points, the sampling and the seed, not on the number of threads
+ */
+
+#include "MSSM.h"
+#include "ParameterSampler.h"
+#include "ResultWriter.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <iostream>
+#include <functional>
+#include <stdexcept>
+
+using std::vector;
+using std::map;
+using std::string;
+
+int main(int argc, char** argv) {
+    const std::size_t num_points = argc > 1 ? std::stoull(argv[1]) : 10000;
+    const string method = argc > 2 ? argv[2] : "lhs";
+    const std::uint64_t seed = argc > 3 ? std::stoull(argv[3]) : 1;
+    const unsigned num_threads = argc > 4 ? std::stoul(argv[4]) : 0;
+    const string f_name = argc > 5 ? argv[5] : "./plots/sample.csv";
+
+    if (method != "random" && method != "lhs") {
+        std::cerr << "usage: sample.out [num_points] [random|lhs] [seed] [num_threads] [file]\n";
+        return 1;
+    }
+
+    double mubarsq = 1.0*1.0; // We set the renormalization scale close to 1 TeV
+
+    // gauge couplings and SM Yukawas as in write_to_files, unspecified parameters remain zero
+    map<string, double> param_dict = {{"g1", 0.37}, {"g2", 0.65}, {"g3", 1.1}, {"cgamma", 0.01}, {"mHsq", 0.125*0.125},
+        {"yu11", 0.00001}, {"yu22", 0.007}};
+
+    // all superpartner masses log-uniform between 0.3 and 5 TeV, and the top Yukawa
+    vector<SampleAxis> axes;
+    for (string mass : {"m1", "m2", "m3", "mPhi", "muTilde", "mqt1", "mqt2", "mqt3", "mut1", "mut2", "mut3",
+                        "mdt1", "mdt2", "mdt3", "mlt1", "mlt2", "mlt3", "met1", "met2", "met3"}) {
+        axes.push_back({mass, 0.3, 5.0, SampleScale::log});
+    }
+    axes.push_back({"yu33", 0.85, 0.95});
+
+    ParameterSampler<MSSM> sampler(param_dict, axes, num_points, method == "lhs" ? Sampling::latin_hypercube : Sampling::random, seed);
+
+    // WCs relevant for top-pair production and two bosonic ones, all taken from one incremental evaluate per point
+    const vector<string> wc_names = {"cG", "cuG", "cqu1", "cuu", "cqq1", "cqd1", "cqu8", "cHG", "cHBox"};
+    const std::size_t num_values = 10;
+    auto fill = [&](MSSM& m, double* values){
+        const MSSMCoefficients wc = m.evaluate(mubarsq, wc_names);
+        values[0] = wc.cG;
+        values[1] = wc.cuG[8];       // cuG_33
+        values[2] = wc.cqu1[8];      // cqu1_1133
+        values[3] = wc.cuu[80];      // cuu_3333
+        values[4] = wc.cqq1[80];     // cqq1_3333
+        values[5] = wc.cqd1[72];     // cqd1_3311
+        values[6] = wc.cqu8[72];     // cqu8_3311
+        values[7] = wc.cqu8[8];      // cqu8_1133
+        values[8] = wc.cHG;
+        values[9] = wc.cHBox;
+    };
+
+    string first_row;
+    for (const SampleAxis& axis : axes) first_row += axis.name + ",";
+    first_row += "cG,cuG_33,cqu1_1133,cuu_3333,cqq1_3333,cqd1_3311,cqu8_3311,cqu8_1133,cHG,cHBox";
+
+    // the parameters with 6 and the WCs with 5 digits after the point, the blocks of the worker threads are written in point order
+    vector<TextColumn> columns(axes.size(), {std::chars_format::scientific, 6});
+    columns.resize(axes.size() + num_values, {std::chars_format::scientific, 5});
+
+    AsyncTextWriter file(f_name, columns);
+    file.writeLine(first_row);
+    sampler.run(num_values, fill, [&file](std::size_t first_point, std::size_t n, const double* rows){ file.writeBlock(first_point, rows, n); }, num_threads);
+    file.close();
+
+    return 0;
+}
@@ -6,6 +6,10 @@
  */
 
 #include "MSSM.h"
+#include "ParameterScan.h"
+#include "AdaptiveScan.h"
+#include "ScanFile.h"
+#include "ResultWriter.h"
 #include <vector>
 #include <print>
 #include <string>
@@ -13,12 +17,14 @@
 #include <format>
 #include <iostream>
 #include <fstream>
+#include <functional>
+#include <algorithm>
+#include <utility>
 
 using std::vector;
 using std::map;
 using std::string;
 using std::format;
-using std::ofstream;
 using std::ios;
 
 int main() {
@@ -59,106 +65,129 @@ int main() {
         i += 1000;
     }
 
-    // a lambda that computes WCs for given (mut3, m1) values and creates a string containing all three
-    auto compute_and_write = [&sb_model](map<string, double> p_dict, double mut3, double m1, auto func){
-        p_dict.emplace("mut3", mut3); // (right-handed) stop mass (in units of TeV)
-        p_dict.emplace("m1", m1); // Bino mass (in units of TeV)
-        sb_model.updateParams(p_dict);
+    // a lambda for writing data to files corresponding to specific WC functions, the (mut3, m1) grid is evaluated on all available cores
+    // and every finished block of points is handed to the writer thread, which formats and writes it while the evaluation continues
+    auto write_wc = [&param_dict](string func_name, std::function<double(MSSM&)> func){
+        string f_name = format("./plots/{}.txt", func_name);
 
-        auto val = func();
-        string line = format("{:.2f} {:.2f} {:.5e}", mut3, m1, val);
+        // (right-handed) stop mass and Bino mass (in units of TeV), 0.3 to 2.7 in steps of 0.1
+        ParameterScan<MSSM> scan(param_dict, {{"mut3", 0.3, 2.7, 25}, {"m1", 0.3, 2.7, 25}});
 
-        return line;
+        // mut3, m1 as {:.2f} and the WC as {:.5e}
+        AsyncTextWriter file(f_name, {{std::chars_format::fixed, 2}, {std::chars_format::fixed, 2}, {std::chars_format::scientific, 5}}, ' ', ios::app);
+        scan.run({func}, [&file](size_t first_point, size_t n, const double* rows){ file.writeBlock(first_point, rows, n); });
+        file.close();
     };
 
-    // a lambda for writing data to files corresponding to specific WC functions
-    auto write_wc = [&param_dict, &compute_and_write](string func_name, auto func){
-        string f_name = format("./plots/{}.txt", func_name);
-
-        ofstream file1;
-        file1.open(f_name, ios::out | ios::app);
-
-        for (double mut3 = 0.3; mut3 < 2.8; mut3 += 0.1) {
-            for (double m1 = 0.3; m1 < 2.8; m1 += 0.1) {
-                file1 << compute_and_write(param_dict, mut3, m1, func) << "\n";
-            }
+    // function calls to write data to files for 2d plots
+    // write_wc("cG", [&mubarsq](MSSM& m){ return m.cG(mubarsq);});
+    // write_wc("cuG_33", [&mubarsq](MSSM& m){ return m.cuG(2,2,mubarsq);});
+    // write_wc("cqu1_1133", [&mubarsq](MSSM& m){ return m.cqu1(0,0,2,2,mubarsq);});
+    // write_wc("cuu_3333", [&mubarsq](MSSM& m){ return m.cuu(2,2,2,2,mubarsq);});
+    // write_wc("cqq1_3333", [&mubarsq](MSSM& m){ return m.cqq1(2,2,2,2,mubarsq);});
+    // write_wc("cqd1_3311", [&mubarsq](MSSM& m){ return m.cqd1(2,2,0,0,mubarsq);});
+    // write_wc("cqu8_3311", [&mubarsq](MSSM& m){ return m.cqu8(2,2,0,0,mubarsq);});
+    // write_wc("cqu8_1133", [&mubarsq](MSSM& m){ return m.cqu8(0,0,2,2,mubarsq);});
+
+    // the same plot data from an adaptive scan: a 4x4 grid (spacing 0.8) refined up to 3 times (spacing 0.1 as in write_wc) only where the WC
+    // deviates from linear interpolation by more than 1% of its range, e.g. cG does not depend on m1 and is only refined along mut3
+    auto write_wc_adaptive = [&param_dict](string func_name, std::function<double(MSSM&)> func){
+        string f_name = format("./plots/{}-adaptive.txt", func_name);
+
+        AdaptiveScan<MSSM> scan(param_dict, {{"mut3", 0.3, 2.7, 4}, {"m1", 0.3, 2.7, 4}}, 3, 0.01);
+        vector<double> vals = scan.run({func});
+
+        AsyncTextWriter file(f_name, {{std::chars_format::fixed, 2}, {std::chars_format::fixed, 2}, {std::chars_format::scientific, 5}}, ' ', ios::app);
+        for (size_t n = 0; n < scan.size(); n++) {
+            vector<double> pt = scan.point(n);
+            file.writeRow(vector<double> {pt[0], pt[1], vals[n]});
         }
-
-        file1.close();
+        file.close();
     };
 
-    // function calls to write data to files for 2d plots
-    // write_wc("cG", [&sb_model, &mubarsq](){ return sb_model.cG(mubarsq);});
-    // write_wc("cuG_33", [&sb_model, &mubarsq](){ return sb_model.cuG(2,2,mubarsq);});
-    // write_wc("cqu1_1133", [&sb_model, &mubarsq](){ return sb_model.cqu1(0,0,2,2,mubarsq);});
-    // write_wc("cuu_3333", [&sb_model, &mubarsq](){ return sb_model.cuu(2,2,2,2,mubarsq);});
-    // write_wc("cqq1_3333", [&sb_model, &mubarsq](){ return sb_model.cqq1(2,2,2,2,mubarsq);});
-    // write_wc("cqd1_3311", [&sb_model, &mubarsq](){ return sb_model.cqd1(2,2,0,0,mubarsq);});
-    // write_wc("cqu8_3311", [&sb_model, &mubarsq](){ return sb_model.cqu8(2,2,0,0,mubarsq);});
-    // write_wc("cqu8_1133", [&sb_model, &mubarsq](){ return sb_model.cqu8(0,0,2,2,mubarsq);});
-
-
-    //  write data to a csv file to creating bar-chart for multiple benchmark points
-    auto create_row_sb = [&sb_model, &mubarsq](map<string, double> p_dict, double mut3, double m1){
-        p_dict.emplace("mut3", mut3); // (right-handed) stop mass (in units of TeV)
-        p_dict.emplace("m1", m1); // Bino mass (in units of TeV)
-        sb_model.updateParams(p_dict);
-
-        string line = format("{:.1f},{:.1f},{:.5e},{:.5e},{:.5e},{:.5e},{:.5e},{:.5e},{:.5e},{:.5e}",
-            mut3, m1,
-            // operators relevant for top-pair production
-            sb_model.cG(mubarsq),
-            sb_model.cuG(2,2,mubarsq),
-            sb_model.cqu1(0,0,2,2,mubarsq),
-            sb_model.cuu(2,2,2,2,mubarsq),
-            sb_model.cqq1(2,2,2,2,mubarsq),
-            sb_model.cqd1(2,2,0,0,mubarsq),
-            sb_model.cqu8(2,2,0,0,mubarsq),
-            sb_model.cqu8(0,0,2,2,mubarsq)
-        );
-
-        return line;
+    // write_wc_adaptive("cG", [&mubarsq](MSSM& m){ return m.cG(mubarsq);});
+    // write_wc_adaptive("cuG_33", [&mubarsq](MSSM& m){ return m.cuG(2,2,mubarsq);});
+
+    // a lambda for writing the same grid for several WC functions to one binary columnar file (see ScanFile.h), read back with ScanFileReader
+    auto write_wcs_bin = [&param_dict](string f_name, vector<string> wc_names, vector<std::function<double(MSSM&)> > funcs){
+        ParameterScan<MSSM> scan(param_dict, {{"mut3", 0.3, 2.7, 25}, {"m1", 0.3, 2.7, 25}});
+        vector<double> vals = scan.run(funcs);
+
+        ScanFileWriter file(f_name, {"mut3", "m1"}, wc_names, scan.size());
+        vector<double> row(2 + funcs.size());
+        for (size_t n = 0; n < scan.size(); n++) {
+            vector<double> pt = scan.point(n);
+            std::copy(pt.begin(), pt.end(), row.begin());
+            std::copy(vals.begin() + n*funcs.size(), vals.begin() + (n + 1)*funcs.size(), row.begin() + 2);
+            file.writeRow(row);
+        }
+        file.close();
     };
 
-    string fname = format("./plots/barplot-sb.csv");
-    ofstream f1;
-    f1.open(fname, ios::out | ios::app);
-    string first_row = format("mut3,m1,cG,cuG_33,cqu1_1133,cuu_3333,cqq1_3333,cqd1_3311,cqu8_3311,cqu8_1133");
+    // write_wcs_bin("./plots/scan-sb.bin", {"cG", "cuG_33", "cuu_3333"}, {
+    //     [&mubarsq](MSSM& m){ return m.cG(mubarsq);},
+    //     [&mubarsq](MSSM& m){ return m.cuG(2,2,mubarsq);},
+    //     [&mubarsq](MSSM& m){ return m.cuu(2,2,2,2,mubarsq);}
+    // });
 
-    f1 << first_row << "\n";
-    f1 << create_row_sb(param_dict, 2.0, 1.5)  << "\n";    // mut3 = 2.0, m1 = 1.5
-    f1 << create_row_sb(param_dict, 1.6, 1.5)  << "\n";    // mut3 = 1.6, m1 = 1.5
-    f1 << create_row_sb(param_dict, 1.6, 0.5)  << "\n";    // mut3 = 1.6, m1 = 0.5
-    f1.close();
 
-    auto create_row_h = [&sb_model, &mubarsq](map<string, double> p_dict, double mut3, double m1){
-        p_dict.emplace("mut3", mut3); // (right-handed) stop mass (in units of TeV)
-        p_dict.emplace("m1", m1); // Bino mass (in units of TeV)
-        sb_model.updateParams(p_dict);
+    //  write data to a csv file to creating bar-chart for multiple benchmark points, only mut3 and m1 change between the rows
+    sb_model.updateParams(param_dict);
 
-        string line = format("{:.1f},{:.1f},{:.5e},{:.5e},{:.5e},{:.5e},{:.5e}",
-            mut3, m1,
-            // purely bosonic operators
-            sb_model.cHBox(mubarsq),
-            sb_model.cHB(mubarsq),
-            sb_model.cHG(mubarsq),
-            sb_model.cuH(2,2,mubarsq),
-            sb_model.cHq1(2,2,mubarsq)
-        );
-
-        return line;
-    };
+    // the terms of the states at 10^6 TeV can be skipped by a pruned evaluation, e.g. below 1e-12 (see setPruning in MSSM.h)
+    // sb_model.setPruning(1e-12);
+
+    // benchmark points (mut3, m1) of the bar charts: (2.0, 1.5), (1.6, 1.5) and (1.6, 0.5)
+    const vector<std::pair<double, double> > bar_points = {{2.0, 1.5}, {1.6, 1.5}, {1.6, 0.5}};
+
+    // a lambda for writing one row per benchmark point, mut3 and m1 as {:.1f} and the values returned by row_values as {:.5e}
+    auto write_bars = [&sb_model, &mubarsq, &bar_points](string f_name, string first_row, vector<string> wc_names,
+                                                         std::function<vector<double>(const MSSMCoefficients&)> row_values){
+        // one column per name in first_row
+        vector<TextColumn> columns = {{std::chars_format::fixed, 1}, {std::chars_format::fixed, 1}};
+        columns.resize(std::count(first_row.begin(), first_row.end(), ',') + 1, {std::chars_format::scientific, 5});
+
+        AsyncTextWriter file(f_name, columns, ',', ios::app);
+        file.writeLine(first_row);
 
-    string fname2 = format("./plots/barplot-h.csv");
-    ofstream f2;
-    f2.open(fname2, ios::out | ios::app);
-    string first_row2 = format("mut3,m1,cHBox,cHB,cHG,cuH_33,cHq1_33");
+        for (auto [mut3, m1] : bar_points) {
+            sb_model.setParam(MSSM::Param::mut3, mut3); // (right-handed) stop mass (in units of TeV)
+            sb_model.setParam(MSSM::Param::m1, m1); // Bino mass (in units of TeV)
 
-    f2 << first_row2 << "\n";
-    f2 << create_row_h(param_dict, 2.0, 1.5)  << "\n";    // mut3 = 2.0, m1 = 1.5
-    f2 << create_row_h(param_dict, 1.6, 1.5)  << "\n";    // mut3 = 1.6, m1 = 1.5
-    f2 << create_row_h(param_dict, 1.6, 0.5)  << "\n";    // mut3 = 1.6, m1 = 0.5
-    f2.close();
+            // only the subexpressions depending on mut3 or m1 are recomputed between the rows
+            vector<double> row = {mut3, m1};
+            for (double value : row_values(sb_model.evaluate(mubarsq, wc_names))) row.push_back(value);
+            file.writeRow(row);
+        }
+        file.close();
+    };
+
+    write_bars("./plots/barplot-sb.csv", "mut3,m1,cG,cuG_33,cqu1_1133,cuu_3333,cqq1_3333,cqd1_3311,cqu8_3311,cqu8_1133",
+        {"cG", "cuG", "cqu1", "cuu", "cqq1", "cqd1", "cqu8"}, [](const MSSMCoefficients& c) -> vector<double> {
+            // operators relevant for top-pair production (flattened row-major flavour indices)
+            return {
+                c.cG,
+                c.cuG[8],       // cuG_33
+                c.cqu1[8],      // cqu1_1133
+                c.cuu[80],      // cuu_3333
+                c.cqq1[80],     // cqq1_3333
+                c.cqd1[72],     // cqd1_3311
+                c.cqu8[72],     // cqu8_3311
+                c.cqu8[8]       // cqu8_1133
+            };
+        });
+
+    write_bars("./plots/barplot-h.csv", "mut3,m1,cHBox,cHB,cHG,cuH_33,cHq1_33",
+        {"cHBox", "cHB", "cHG", "cuH", "cHq1"}, [](const MSSMCoefficients& c) -> vector<double> {
+            // purely bosonic operators
+            return {
+                c.cHBox,
+                c.cHB,
+                c.cHG,
+                c.cuH[8],       // cuH_33
+                c.cHq1[8]       // cHq1_33
+            };
+        });
 
     return 0;
 }